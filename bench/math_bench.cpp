@@ -0,0 +1,767 @@
+/**
+ * @file math_bench.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief microbenchmark of the public math functions, reports ns/op, ops/s and
+ * cycles/op over a warm (L1 resident) and a cold (larger than the last level
+ * cache, visited in random order) working set.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * usage: math_bench [--json] [--filter <text>] [--repetitions <n>]
+ *  --json          machine readable output on stdout.
+ *  --filter        only run the functions whose name contains <text>.
+ *  --repetitions   runs per function and working set, the fastest is kept.
+ */
+#include <chrono>
+#include <float.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include <math/capsule.h>
+#include <math/capsule_batch.h>
+#include <math/dualquatf.h>
+#include <math/face.h>
+#include <math/frustum.h>
+#include <math/matrix3f.h>
+#include <math/matrix4f.h>
+#include <math/plane.h>
+#include <math/quatf.h>
+#include <math/quatf_batch.h>
+#include <math/ray.h>
+#include <math/segment.h>
+#include <math/segment_batch.h>
+#include <math/transform.h>
+#include <math/vector3f.h>
+#include <math/cpp/constexpr.hpp>
+#include <math/cpp/quatf.hpp>
+#include <math/cpp/shapes.hpp>
+
+#ifndef MATH_VERSION
+#define MATH_VERSION "unknown"
+#endif
+
+
+#define BENCH_WARM_COUNT 64
+#define BENCH_COLD_BYTES (64 << 20)
+#define BENCH_OUTPUT_MASK 63
+#define BENCH_BATCH 64
+#define BENCH_REPETITIONS 5
+
+typedef
+struct bench_input_t {
+  matrix4f m4[2];               // m4[1] is a pure rotation.
+  matrix3f m3[2];
+  quatf q[2];                   // unit.
+  dualquatf dq[2];              // unit.
+  affine3f affine[2];
+  rigid3f rigid[2];
+  vector3f v[2];                // v[0] is unit.
+  face_t face;
+  plane_t plane;                // of face.
+  segment_t segment[2];
+  segment_form_t segment_form;  // of segment[0].
+  capsule_t capsule;
+  oriented_capsule_t oriented_capsule;  // of capsule and q[0].
+  sphere_t sphere;
+  frustum_t frustum;            // of m4[0].
+  ray_t ray;                    // through face.
+  float f;                      // in [0, 1].
+} bench_input_t;
+
+typedef
+union bench_output_t {
+  matrix4f m4;
+  matrix3f m3;
+  quatf q;
+  dualquatf dq;
+  affine3f affine;
+  rigid3f rigid;
+  vector3f v;
+  face_t face;
+  plane_t plane;
+  segment_t segment;
+  segment_form_t segment_form;
+  frustum_t frustum;
+  ray_hit_t hit;
+  aabb_t aabb;
+  float f;
+  int32_t i;
+} bench_output_t;
+
+typedef void (*bench_function_t)(const uint32_t *order, uint32_t count);
+
+typedef
+struct bench_t {
+  const char *header;
+  const char *name;
+  bench_function_t function;
+  uint32_t batch;               // elements processed per call.
+} bench_t;
+
+typedef
+struct bench_result_t {
+  double ns_per_op;
+  double cycles_per_op;
+} bench_result_t;
+
+static bench_input_t *g_inputs;
+static uint32_t g_input_count;
+static face_t *g_faces;
+static uint32_t g_face_count;
+static bench_output_t g_outputs[BENCH_OUTPUT_MASK + 1];
+static vector3f g_normals[BENCH_BATCH];
+static point3f g_points[BENCH_BATCH];
+// the rotation conversions and capsule bounds read the same BENCH_BATCH
+// inputs in both sets, g_rotations[i] and g_rotations3[i] are the matrices of
+// g_quats[i].
+static quatf g_quats[BENCH_BATCH];
+static matrix4f g_rotations[BENCH_BATCH];
+static matrix3f g_rotations3[BENCH_BATCH];
+static quatf g_quats_out[BENCH_BATCH];
+static matrix4f g_matrices_out[BENCH_BATCH];
+static matrix3f g_matrices3_out[BENCH_BATCH];
+static rigid3f g_rigids_out[BENCH_BATCH];
+static oriented_capsule_t g_capsules[BENCH_BATCH];
+static aabb_t g_bounds_out[BENCH_BATCH];
+
+////////////////////////////////////////////////////////////////////////////////
+// every statement reads 'in' and writes its result to 'out', the output ring
+// is global so the compiler cannot drop the work.
+#define BENCH_LIST(X) \
+  X(vector3f, vector3f_set_1f, vector3f_set_1f(&out->v, in->f)) \
+  X(vector3f, vector3f_set_3f, \
+    vector3f_set_3f(&out->v, in->f, in->v[1].data[1], in->v[1].data[2])) \
+  X(vector3f, vector3f_copy, vector3f_copy(&out->v, in->v)) \
+  X(vector3f, vector3f_set_a3f, vector3f_set_a3f(&out->v, in->v[1].data)) \
+  X(vector3f, vector3f_set_diff_v3f, \
+    vector3f_set_diff_v3f(&out->v, in->v, in->v + 1)) \
+  X(vector3f, length_v3f, out->f = length_v3f(in->v + 1)) \
+  X(vector3f, length_squared_v3f, out->f = length_squared_v3f(in->v + 1)) \
+  X(vector3f, dot_product_v3f, out->f = dot_product_v3f(in->v, in->v + 1)) \
+  X(vector3f, cross_product_v3f, \
+    out->v = cross_product_v3f(in->v, in->v + 1)) \
+  X(vector3f, normalize_v3f, out->v = normalize_v3f(in->v + 1)) \
+  X(vector3f, normalize_set_v3f, \
+    out->v = in->v[1]; normalize_set_v3f(&out->v)) \
+  X(vector3f, normalize_v3f_mp, out->v = normalize_v3f_mp(in->v + 1)) \
+  X(vector3f, normalize_v3f_np, out->v = normalize_v3f_np(in->v + 1)) \
+  X(vector3f, normalize_set_v3f_mp, \
+    out->v = in->v[1]; normalize_set_v3f_mp(&out->v)) \
+  X(vector3f, normalize_set_v3f_np, \
+    out->v = in->v[1]; normalize_set_v3f_np(&out->v)) \
+  X(vector3f, equal_to_v3f, out->i = equal_to_v3f(in->v, in->v + 1)) \
+  X(vector3f, negate_v3f, out->v = negate_v3f(in->v)) \
+  X(vector3f, negate_set_v3f, out->v = in->v[0]; negate_set_v3f(&out->v)) \
+  X(vector3f, diff_v3f, out->v = diff_v3f(in->v, in->v + 1)) \
+  X(vector3f, diff_set_v3f, \
+    out->v = in->v[0]; diff_set_v3f(&out->v, in->v + 1)) \
+  X(vector3f, add_v3f, out->v = add_v3f(in->v, in->v + 1)) \
+  X(vector3f, add_set_v3f, \
+    out->v = in->v[0]; add_set_v3f(&out->v, in->v + 1)) \
+  X(vector3f, mult_v3f, out->v = mult_v3f(in->v, in->f)) \
+  X(vector3f, mult_set_v3f, \
+    out->v = in->v[0]; mult_set_v3f(&out->v, in->f)) \
+  X(vector3f, div_v3f, out->v = div_v3f(in->v, in->f + 1.f)) \
+  X(vector3f, div_set_v3f, \
+    out->v = in->v[0]; div_set_v3f(&out->v, in->f + 1.f)) \
+  X(vector3f, lerp_v3f, out->v = lerp_v3f(in->v[0], in->v[1], in->f)) \
+  X(cpp/vector3f, vec3_lerp, \
+    out->v = math::vec3( \
+      math::lerp(math::vec3(in->v[0]), math::vec3(in->v[1]), in->f))) \
+  \
+  X(matrix3f, matrix3f_set_identity, matrix3f_set_identity(&out->m3)) \
+  X(matrix3f, matrix3f_copy, matrix3f_copy(&out->m3, in->m3)) \
+  X(matrix3f, matrix3f_set_axisangle, \
+    matrix3f_set_axisangle(&out->m3, in->v, in->f * 360.f)) \
+  X(matrix3f, determinant_m3f, out->f = determinant_m3f(in->m3)) \
+  X(matrix3f, mult_m3f, out->m3 = mult_m3f(in->m3, in->m3 + 1)) \
+  X(matrix3f, mult_set_m3f, \
+    out->m3 = in->m3[0]; mult_set_m3f(&out->m3, in->m3 + 1)) \
+  X(matrix3f, mult_m3f_f, out->m3 = mult_m3f_f(in->m3, in->f)) \
+  X(matrix3f, mult_set_m3f_f, \
+    out->m3 = in->m3[0]; mult_set_m3f_f(&out->m3, in->f)) \
+  X(matrix3f, add_m3f, out->m3 = add_m3f(in->m3, in->m3 + 1)) \
+  X(matrix3f, add_set_m3f, \
+    out->m3 = in->m3[0]; add_set_m3f(&out->m3, in->m3 + 1)) \
+  X(matrix3f, mult_m3f_vec3f, out->v = mult_m3f_vec3f(in->m3, in->v + 1)) \
+  X(matrix3f, mult_set_m3f_vec3f, \
+    out->v = in->v[1]; mult_set_m3f_vec3f(in->m3, &out->v)) \
+  \
+  X(matrix4f, matrix4f_set_identity, matrix4f_set_identity(&out->m4)) \
+  X(matrix4f, matrix4f_copy, matrix4f_copy(&out->m4, in->m4)) \
+  X(matrix4f, matrix4f_rotation_x, matrix4f_rotation_x(&out->m4, in->f)) \
+  X(matrix4f, matrix4f_rotation_y, matrix4f_rotation_y(&out->m4, in->f)) \
+  X(matrix4f, matrix4f_rotation_z, matrix4f_rotation_z(&out->m4, in->f)) \
+  X(matrix4f, matrix4f_translation, \
+    matrix4f_translation( \
+      &out->m4, in->v[1].data[0], in->v[1].data[1], in->v[1].data[2])) \
+  X(matrix4f, matrix4f_scale, \
+    matrix4f_scale( \
+      &out->m4, in->v[1].data[0], in->v[1].data[1], in->v[1].data[2])) \
+  X(matrix4f, matrix4f_set_axisangle, \
+    matrix4f_set_axisangle(&out->m4, in->v, in->f * 360.f)) \
+  X(matrix4f, matrix4f_cross_product, \
+    matrix4f_cross_product(&out->m4, in->v + 1)) \
+  X(matrix4f, matrix4f_set_column_major, \
+    matrix4f_set_column_major(&out->m4, in->m4)) \
+  X(matrix4f, determinant_m4f, out->f = determinant_m4f(in->m4)) \
+  X(matrix4f, transpose_m4f, out->m4 = transpose_m4f(in->m4)) \
+  X(matrix4f, transpose_set_m4f, \
+    out->m4 = in->m4[0]; transpose_set_m4f(&out->m4)) \
+  X(matrix4f, inverse_m4f, out->m4 = inverse_m4f(in->m4)) \
+  X(matrix4f, inverse_set_m4f, \
+    out->m4 = in->m4[0]; inverse_set_m4f(&out->m4)) \
+  X(matrix4f, to_axisangle_m4f, \
+    to_axisangle_m4f(in->m4 + 1, &out->v, &g_outputs[0].f)) \
+  X(matrix4f, mult_m4f, out->m4 = mult_m4f(in->m4, in->m4 + 1)) \
+  X(matrix4f, mult_set_m4f, \
+    out->m4 = in->m4[0]; mult_set_m4f(&out->m4, in->m4 + 1)) \
+  X(matrix4f, mult_m4f_f, out->m4 = mult_m4f_f(in->m4, in->f)) \
+  X(matrix4f, mult_set_m4f_f, \
+    out->m4 = in->m4[0]; mult_set_m4f_f(&out->m4, in->f)) \
+  X(matrix4f, mult_m4f_v3f, out->v = mult_m4f_v3f(in->m4, in->v + 1)) \
+  X(matrix4f, mult_set_m4f_v3f, \
+    out->v = in->v[1]; mult_set_m4f_v3f(in->m4, &out->v)) \
+  X(matrix4f, mult_m4f_p3f, out->v = mult_m4f_p3f(in->m4, in->v + 1)) \
+  X(matrix4f, mult_set_m4f_p3f, \
+    out->v = in->v[1]; mult_set_m4f_p3f(in->m4, &out->v)) \
+  \
+  X(quatf, quatf_set_4f, \
+    quatf_set_4f(&out->q, in->f, in->v[0].data[0], in->v[0].data[1], \
+      in->v[0].data[2])) \
+  X(quatf, quatf_copy, quatf_copy(&out->q, in->q)) \
+  X(quatf, quatf_set_identity, quatf_set_identity(&out->q)) \
+  X(quatf, quatf_set_a4f, quatf_set_a4f(&out->q, in->q[1].data)) \
+  X(quatf, quatf_set_from_axis_angle, \
+    quatf_set_from_axis_angle(&out->q, in->v, in->f)) \
+  X(quatf, quatf_set_from_rotation_matrix3f, \
+    quatf_set_from_rotation_matrix3f(&out->q, in->m3 + 1)) \
+  X(quatf, quatf_set_from_rotation_matrix4f, \
+    quatf_set_from_rotation_matrix4f(&out->q, in->m4 + 1)) \
+  X(quatf, get_quatf_axis_angle, \
+    get_quatf_axis_angle(in->q[0], &out->v, &g_outputs[0].f)) \
+  X(quatf, length_quatf, out->f = length_quatf(in->q)) \
+  X(quatf, quatf_set_normalize, \
+    out->q = in->q[0]; quatf_set_normalize(&out->q)) \
+  X(quatf, quatf_set_normalize_mp, \
+    out->q = in->q[0]; quatf_set_normalize_mp(&out->q)) \
+  X(quatf, quatf_set_normalize_np, \
+    out->q = in->q[0]; quatf_set_normalize_np(&out->q)) \
+  X(quatf, length_squared_quatf, out->f = length_squared_quatf(in->q)) \
+  X(quatf, dot_product_quatf, out->f = dot_product_quatf(in->q, in->q + 1)) \
+  X(quatf, mult_quatf_f, out->q = mult_quatf_f(in->q, in->f)) \
+  X(quatf, mult_set_quatf_f, \
+    out->q = in->q[0]; mult_set_quatf_f(&out->q, in->f)) \
+  X(quatf, add_quatf, out->q = add_quatf(in->q, in->q + 1)) \
+  X(quatf, add_set_quatf, \
+    out->q = in->q[0]; add_set_quatf(&out->q, in->q + 1)) \
+  X(quatf, mult_quatf, out->q = mult_quatf(in->q, in->q + 1)) \
+  X(quatf, mult_set_quatf, \
+    out->q = in->q[0]; mult_set_quatf(&out->q, in->q + 1)) \
+  X(quatf, mult_quatf_v3f, out->v = mult_quatf_v3f(in->q, in->v + 1)) \
+  X(quatf, mult_quatf_v3f_unit, \
+    out->v = mult_quatf_v3f_unit(in->q, in->v + 1)) \
+  X(quatf, inverse_quatf, out->q = inverse_quatf(in->q)) \
+  X(quatf, inverse_set_quatf, \
+    out->q = in->q[0]; inverse_set_quatf(&out->q)) \
+  X(quatf, conjugate_quatf, out->q = conjugate_quatf(in->q)) \
+  X(quatf, conjugate_set_quatf, \
+    out->q = in->q[0]; conjugate_set_quatf(&out->q)) \
+  X(quatf, lerp_quatf, out->q = lerp_quatf(in->q[0], in->q[1], in->f)) \
+  X(quatf, slerp_quatf, out->q = slerp_quatf(in->q[0], in->q[1], in->f)) \
+  X(quatf, quatf_to_matrix4f, out->m4 = quatf_to_matrix4f(in->q[0])) \
+  X(quatf_batch, slerp_quatf_fast, \
+    out->q = slerp_quatf_fast(in->q[0], in->q[1], in->f)) \
+  X(quatf_batch, nlerp_quatf, \
+    out->q = nlerp_quatf(in->q[0], in->q[1], in->f)) \
+  \
+  X(dualquatf, dualquatf_set_identity, dualquatf_set_identity(&out->dq)) \
+  X(dualquatf, dualquatf_set_from_quatf_v3f, \
+    dualquatf_set_from_quatf_v3f(&out->dq, in->q, in->v + 1)) \
+  X(dualquatf, dualquatf_set_from_matrix4f, \
+    dualquatf_set_from_matrix4f(&out->dq, in->m4)) \
+  X(dualquatf, get_dualquatf_translation, \
+    out->v = get_dualquatf_translation(in->dq)) \
+  X(dualquatf, dualquatf_to_matrix4f, \
+    out->m4 = dualquatf_to_matrix4f(in->dq[0])) \
+  X(dualquatf, dualquatf_set_normalize, \
+    out->dq = in->dq[0]; dualquatf_set_normalize(&out->dq)) \
+  X(dualquatf, mult_dualquatf, out->dq = mult_dualquatf(in->dq, in->dq + 1)) \
+  X(dualquatf, mult_set_dualquatf, \
+    out->dq = in->dq[0]; mult_set_dualquatf(&out->dq, in->dq + 1)) \
+  X(dualquatf, conjugate_dualquatf, out->dq = conjugate_dualquatf(in->dq)) \
+  X(dualquatf, mult_dualquatf_v3f, \
+    out->v = mult_dualquatf_v3f(in->dq, in->v + 1)) \
+  X(dualquatf, mult_dualquatf_p3f, \
+    out->v = mult_dualquatf_p3f(in->dq, in->v + 1)) \
+  X(dualquatf, blend_dualquatf, \
+    out->dq = blend_dualquatf(in->dq, in->q[0].data, 2)) \
+  \
+  X(transform, affine3f_set_identity, affine3f_set_identity(&out->affine)) \
+  X(transform, affine3f_set_from_matrix4f, \
+    affine3f_set_from_matrix4f(&out->affine, in->m4)) \
+  X(transform, affine3f_set_from_rigid3f, \
+    affine3f_set_from_rigid3f(&out->affine, in->rigid)) \
+  X(transform, affine3f_to_matrix4f, \
+    out->m4 = affine3f_to_matrix4f(in->affine)) \
+  X(transform, mult_affine3f, \
+    out->affine = mult_affine3f(in->affine, in->affine + 1)) \
+  X(transform, mult_set_affine3f, \
+    out->affine = in->affine[0]; \
+    mult_set_affine3f(&out->affine, in->affine + 1)) \
+  X(transform, mult_affine3f_p3f, \
+    out->v = mult_affine3f_p3f(in->affine, in->v + 1)) \
+  X(transform, mult_affine3f_v3f, \
+    out->v = mult_affine3f_v3f(in->affine, in->v + 1)) \
+  X(transform, inverse_affine3f, out->affine = inverse_affine3f(in->affine)) \
+  X(transform, inverse_set_affine3f, \
+    out->affine = in->affine[0]; inverse_set_affine3f(&out->affine)) \
+  X(transform, rigid3f_set_identity, rigid3f_set_identity(&out->rigid)) \
+  X(transform, rigid3f_set_from_matrix4f, \
+    rigid3f_set_from_matrix4f(&out->rigid, in->m4)) \
+  X(transform, rigid3f_set_from_matrix3f_v3f, \
+    rigid3f_set_from_matrix3f_v3f(&out->rigid, in->m3, in->v + 1)) \
+  X(transform, rigid3f_to_matrix4f, out->m4 = rigid3f_to_matrix4f(in->rigid)) \
+  X(transform, mult_rigid3f, \
+    out->rigid = mult_rigid3f(in->rigid, in->rigid + 1)) \
+  X(transform, mult_set_rigid3f, \
+    out->rigid = in->rigid[0]; mult_set_rigid3f(&out->rigid, in->rigid + 1)) \
+  X(transform, mult_rigid3f_p3f, \
+    out->v = mult_rigid3f_p3f(in->rigid, in->v + 1)) \
+  X(transform, mult_rigid3f_v3f, \
+    out->v = mult_rigid3f_v3f(in->rigid, in->v + 1)) \
+  X(transform, inverse_rigid3f, out->rigid = inverse_rigid3f(in->rigid)) \
+  X(transform, inverse_set_rigid3f, \
+    out->rigid = in->rigid[0]; inverse_set_rigid3f(&out->rigid)) \
+  \
+  X(segment, closest_point_on_segment, \
+    out->v = closest_point_on_segment(in->v + 1, in->segment)) \
+  X(segment, closest_point_on_segment_loose, \
+    out->v = closest_point_on_segment_loose( \
+      in->v + 1, in->segment[0].points, in->segment[0].points + 1)) \
+  X(segment, get_point_distance_to_line, \
+    out->f = get_point_distance_to_line(in->v + 1, in->segment)) \
+  X(segment, segment_form_set_from_segment, \
+    segment_form_set_from_segment(&out->segment_form, in->segment)) \
+  X(segment, closest_point_on_segment_form, \
+    out->v = closest_point_on_segment_form(in->v + 1, &in->segment_form)) \
+  X(segment, get_point_distance_to_line_form, \
+    out->f = get_point_distance_to_line_form(in->v + 1, &in->segment_form)) \
+  X(segment, closest_points_on_segments, \
+    out->f = closest_points_on_segments( \
+      in->segment, in->segment + 1, &out->segment.points[0], \
+      &out->segment.points[1])) \
+  \
+  X(face, get_extended_face, \
+    out->face = get_extended_face(&in->face, in->f)) \
+  X(face, get_face_normal_safe, get_face_normal_safe(&in->face, &out->v)) \
+  X(face, get_point_distance, \
+    out->f = get_point_distance(&in->face, in->v, in->v + 1)) \
+  X(face, get_point_projection, \
+    out->v = get_point_projection( \
+      &in->face, in->v, in->v + 1, &g_outputs[0].f)) \
+  X(face, closest_point_on_face, \
+    out->v = closest_point_on_face(in->v + 1, &in->face)) \
+  X(face, closest_points_segment_face, \
+    out->f = closest_points_segment_face( \
+      in->segment, &in->face, &out->segment.points[0], \
+      &out->segment.points[1])) \
+  \
+  X(plane, plane_set_from_face, plane_set_from_face(&out->plane, &in->face)) \
+  X(plane, get_plane_distance, \
+    out->f = get_plane_distance(&in->plane, in->v + 1)) \
+  X(plane, get_plane_projection, \
+    out->v = get_plane_projection(&in->plane, in->v + 1, &g_outputs[0].f)) \
+  \
+  X(capsule, get_capsule_segment, \
+    get_capsule_segment(&in->capsule, &out->segment)) \
+  X(capsule, get_capsule_segment_loose, \
+    get_capsule_segment_loose( \
+      &in->capsule, &out->segment.points[0], &out->segment.points[1])) \
+  X(capsule, get_capsule_segment_m4f, \
+    get_capsule_segment_m4f(&in->capsule, in->m4, &out->segment)) \
+  X(capsule, get_capsule_segment_quatf, \
+    get_capsule_segment_quatf(&in->capsule, in->q, &out->segment)) \
+  X(capsule, get_oriented_capsule_segment, \
+    get_oriented_capsule_segment(&in->oriented_capsule, &out->segment)) \
+  X(capsule, get_oriented_capsule_aabb, \
+    get_oriented_capsule_aabb(&in->oriented_capsule, &out->aabb)) \
+  \
+  X(frustum, frustum_set_from_matrix4f, \
+    frustum_set_from_matrix4f( \
+      &out->frustum, in->m4, FRUSTUM_DEPTH_NEGATIVE_ONE_TO_ONE)) \
+  X(frustum, is_sphere_in_frustum, \
+    out->i = is_sphere_in_frustum(&in->frustum, &in->sphere)) \
+  X(frustum, is_capsule_in_frustum, \
+    out->i = is_capsule_in_frustum(&in->frustum, &in->capsule)) \
+  \
+  X(ray, raycast_face, \
+    out->hit.distance = FLT_MAX; \
+    out->i = raycast_face(&in->ray, &in->face, 0, &out->hit))
+
+// the array functions are timed over BENCH_BATCH contiguous faces per call,
+// 'faces' points to the first one. The point kernels read g_points.
+#define BENCH_BATCH_LIST(X) \
+  X(face, get_faces_normals, \
+    get_faces_normals(faces, BENCH_BATCH, g_normals)) \
+  X(face, get_faces_normals_fast, \
+    get_faces_normals_fast(faces, BENCH_BATCH, g_normals)) \
+  X(face, get_faces_normals_partition, \
+    get_faces_normals_partition(faces, BENCH_BATCH, g_normals, 0, 1)) \
+  X(segment_batch, closest_point_on_segment_array, \
+    closest_point_on_segment_array( \
+      &g_inputs[0].segment_form, g_points, g_normals, BENCH_BATCH)) \
+  X(quatf_batch, mult_quatf_v3f_array, \
+    mult_quatf_v3f_array( \
+      g_inputs[0].q, g_points, g_normals, BENCH_BATCH)) \
+  X(quatf_batch, quatf_set_from_rotation_matrix4f_array, \
+    quatf_set_from_rotation_matrix4f_array( \
+      g_quats_out, g_rotations, BENCH_BATCH)) \
+  X(quatf_batch, quatf_set_from_rotation_matrix3f_array, \
+    quatf_set_from_rotation_matrix3f_array( \
+      g_quats_out, g_rotations3, BENCH_BATCH)) \
+  X(quatf_batch, quatf_to_matrix4f_array, \
+    quatf_to_matrix4f_array(g_quats, g_matrices_out, BENCH_BATCH)) \
+  X(quatf_batch, quatf_to_matrix3f_array, \
+    quatf_to_matrix3f_array(g_quats, g_matrices3_out, BENCH_BATCH)) \
+  X(quatf_batch, quatf_to_matrix3x4f_array, \
+    quatf_to_matrix3x4f_array( \
+      g_quats, NULL, g_rigids_out, BENCH_BATCH)) \
+  X(capsule_batch, get_oriented_capsule_aabb_array, \
+    get_oriented_capsule_aabb_array(g_capsules, g_bounds_out, BENCH_BATCH))
+
+#define BENCH_DEFINE(HEADER, NAME, ...) \
+static \
+void \
+bench_##NAME(const uint32_t *order, uint32_t count) \
+{ \
+  for (uint32_t i = 0; i < count; ++i) { \
+    const bench_input_t *in = g_inputs + order[i]; \
+    bench_output_t *out = g_outputs + (i & BENCH_OUTPUT_MASK); \
+    (void)in; \
+    __VA_ARGS__; \
+  } \
+}
+
+#define BENCH_BATCH_DEFINE(HEADER, NAME, ...) \
+static \
+void \
+bench_##NAME(const uint32_t *order, uint32_t count) \
+{ \
+  for (uint32_t i = 0; i < count; ++i) { \
+    const face_t *faces = g_faces + order[i] * BENCH_BATCH; \
+    (void)faces; \
+    __VA_ARGS__; \
+  } \
+}
+
+#define BENCH_ENTRY(HEADER, NAME, ...) { #HEADER, #NAME, bench_##NAME, 1 },
+#define BENCH_BATCH_ENTRY(HEADER, NAME, ...) \
+  { #HEADER, #NAME, bench_##NAME, BENCH_BATCH },
+
+BENCH_LIST(BENCH_DEFINE)
+BENCH_BATCH_LIST(BENCH_BATCH_DEFINE)
+
+static const bench_t g_benches[] = {
+  BENCH_LIST(BENCH_ENTRY)
+  BENCH_BATCH_LIST(BENCH_BATCH_ENTRY)
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// xorshift32, the inputs are the same from one run to the next.
+static uint32_t g_seed = 0x9e3779b9;
+
+static
+uint32_t
+bench_random_u32(void)
+{
+  g_seed ^= g_seed << 13;
+  g_seed ^= g_seed >> 17;
+  g_seed ^= g_seed << 5;
+  return g_seed;
+}
+
+// in [0, 1).
+static
+float
+bench_random(void)
+{
+  return (bench_random_u32() >> 8) / (float)(1 << 24);
+}
+
+static
+void
+bench_random_v3f(vector3f *dst, float scale)
+{
+  vector3f_set_3f(
+    dst,
+    (bench_random() * 2.f - 1.f) * scale,
+    (bench_random() * 2.f - 1.f) * scale,
+    (bench_random() * 2.f - 1.f) * scale);
+}
+
+static
+void
+bench_random_unit_v3f(vector3f *dst)
+{
+  do {
+    bench_random_v3f(dst, 1.f);
+  } while (length_squared_v3f(dst) < 0.01f);
+  normalize_set_v3f(dst);
+}
+
+static
+void
+bench_set_input(bench_input_t *dst)
+{
+  vector3f axis;
+  matrix4f translation;
+
+  bench_random_unit_v3f(&axis);
+  quatf_set_from_axis_angle(dst->q + 0, &axis, bench_random() * 6.f);
+  bench_random_unit_v3f(&axis);
+  quatf_set_from_axis_angle(dst->q + 1, &axis, bench_random() * 6.f);
+
+  dst->m4[1] = quatf_to_matrix4f(dst->q[1]);
+  matrix4f_translation(
+    &translation, bench_random(), bench_random(), bench_random());
+  dst->m4[0] = mult_m4f(&translation, dst->m4 + 1);
+  matrix3f_set_axisangle(dst->m3 + 0, &axis, bench_random() * 360.f);
+  bench_random_unit_v3f(&axis);
+  matrix3f_set_axisangle(dst->m3 + 1, &axis, bench_random() * 360.f);
+
+  bench_random_unit_v3f(dst->v + 0);
+  bench_random_v3f(dst->v + 1, 4.f);
+  dualquatf_set_from_quatf_v3f(dst->dq + 0, dst->q + 0, dst->v + 1);
+  dualquatf_set_from_quatf_v3f(dst->dq + 1, dst->q + 1, dst->v + 0);
+  for (uint32_t i = 0; i < 2; ++i) {
+    matrix4f scale;
+    matrix4f_scale(&scale, bench_random() + 0.5f, 1.f, bench_random() + 0.5f);
+    scale = mult_m4f(dst->m4 + i, &scale);
+    affine3f_set_from_matrix4f(dst->affine + i, &scale);
+    rigid3f_set_from_matrix4f(dst->rigid + i, dst->m4 + i);
+  }
+
+  for (uint32_t i = 0; i < 3; ++i)
+    bench_random_v3f(dst->face.points + i, 2.f);
+  plane_set_from_face(&dst->plane, &dst->face);
+  bench_random_v3f(&dst->ray.origin, 4.f);
+  dst->ray.direction = add_v3f(dst->face.points + 0, dst->face.points + 1);
+  dst->ray.direction = add_v3f(&dst->ray.direction, dst->face.points + 2);
+  dst->ray.direction = mult_v3f(&dst->ray.direction, 1.f / 3.f);
+  dst->ray.direction = diff_v3f(&dst->ray.origin, &dst->ray.direction);
+  for (uint32_t i = 0; i < 2; ++i) {
+    bench_random_v3f(dst->segment[i].points + 0, 3.f);
+    bench_random_v3f(dst->segment[i].points + 1, 3.f);
+  }
+  segment_form_set_from_segment(&dst->segment_form, dst->segment);
+
+  bench_random_v3f(&dst->capsule.center, 4.f);
+  dst->capsule.half_height = bench_random() + 0.1f;
+  dst->capsule.radius = bench_random() + 0.1f;
+  dst->oriented_capsule.center = dst->capsule.center;
+  dst->oriented_capsule.orientation = dst->q[0];
+  dst->oriented_capsule.half_height = dst->capsule.half_height;
+  dst->oriented_capsule.radius = dst->capsule.radius;
+  bench_random_v3f(&dst->sphere.center, 4.f);
+  dst->sphere.radius = bench_random() + 0.1f;
+  frustum_set_from_matrix4f(
+    &dst->frustum, dst->m4, FRUSTUM_DEPTH_NEGATIVE_ONE_TO_ONE);
+  dst->f = bench_random();
+}
+
+// fisher-yates shuffle of [0, range) repeated over 'count' entries.
+static
+void
+bench_set_order(uint32_t *order, uint32_t count, uint32_t range)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    order[i] = i % range;
+  for (uint32_t i = count - 1; i > 0; --i) {
+    uint32_t j = bench_random_u32() % (i + 1), swap = order[i];
+    order[i] = order[j];
+    order[j] = swap;
+  }
+}
+
+static
+uint64_t
+bench_rdtsc(void)
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static
+bench_result_t
+bench_run(
+  const bench_t *bench,
+  const uint32_t *order,
+  uint32_t count,
+  uint32_t repetitions)
+{
+  bench_result_t result = { 0., 0. };
+  double ops = (double)count * bench->batch;
+
+  // one untimed pass to fault in the pages and settle the clocks.
+  bench->function(order, count);
+
+  for (uint32_t i = 0; i < repetitions; ++i) {
+    std::chrono::steady_clock::time_point start, end;
+    uint64_t cycles;
+    double ns;
+
+    start = std::chrono::steady_clock::now();
+    cycles = bench_rdtsc();
+    bench->function(order, count);
+    cycles = bench_rdtsc() - cycles;
+    end = std::chrono::steady_clock::now();
+
+    ns = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+    if (i == 0 || ns < result.ns_per_op) {
+      result.ns_per_op = ns;
+      result.cycles_per_op = cycles / ops;
+    }
+  }
+
+  return result;
+}
+
+static
+const char *
+bench_simd_name(void)
+{
+#if defined(MATH_SIMD_AVX2)
+  return "avx2";
+#elif defined(MATH_SIMD_SSE2)
+  return "sse2";
+#else
+  return "scalar";
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int
+main(int argc, char **argv)
+{
+  const char *filter = NULL;
+  uint32_t repetitions = BENCH_REPETITIONS, json = 0, first = 1;
+  uint32_t *warm, *cold, *batch_warm, *batch_cold, batch_count;
+  const uint32_t bench_count = sizeof(g_benches) / sizeof(g_benches[0]);
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--json"))
+      json = 1;
+    else if (!strcmp(argv[i], "--filter") && i + 1 < argc)
+      filter = argv[++i];
+    else if (!strcmp(argv[i], "--repetitions") && i + 1 < argc)
+      repetitions = (uint32_t)atoi(argv[++i]);
+    else {
+      fprintf(
+        stderr,
+        "usage: %s [--json] [--filter <text>] [--repetitions <n>]\n", argv[0]);
+      return 1;
+    }
+  }
+  repetitions = repetitions ? repetitions : 1;
+
+  // both working sets run the same number of operations, the warm set keeps
+  // revisiting the first BENCH_WARM_COUNT inputs.
+  g_input_count = BENCH_COLD_BYTES / sizeof(bench_input_t);
+  g_face_count = BENCH_COLD_BYTES / sizeof(face_t) / BENCH_BATCH * BENCH_BATCH;
+  batch_count = g_face_count / BENCH_BATCH;
+  g_inputs = (bench_input_t *)malloc(sizeof(bench_input_t) * g_input_count);
+  g_faces = (face_t *)malloc(sizeof(face_t) * g_face_count);
+  warm = (uint32_t *)malloc(sizeof(uint32_t) * g_input_count);
+  cold = (uint32_t *)malloc(sizeof(uint32_t) * g_input_count);
+  batch_warm = (uint32_t *)calloc(batch_count, sizeof(uint32_t));
+  batch_cold = (uint32_t *)malloc(sizeof(uint32_t) * batch_count);
+  if (!g_inputs || !g_faces || !warm || !cold || !batch_warm || !batch_cold) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  for (uint32_t i = 0; i < g_input_count; ++i)
+    bench_set_input(g_inputs + i);
+  for (uint32_t i = 0; i < g_face_count; ++i)
+    g_faces[i] = g_inputs[i % g_input_count].face;
+  for (uint32_t i = 0; i < BENCH_BATCH; ++i) {
+    bench_random_v3f(g_points + i, 4.f);
+    g_quats[i] = g_inputs[i].q[0];
+    g_rotations[i] = quatf_to_matrix4f(g_quats[i]);
+    for (uint32_t r = 0; r < 3; ++r)
+      for (uint32_t c = 0; c < 3; ++c)
+        g_rotations3[i].data[r * 3 + c] = g_rotations[i].data[r * 4 + c];
+    g_capsules[i] = g_inputs[i].oriented_capsule;
+  }
+  bench_set_order(warm, g_input_count, BENCH_WARM_COUNT);
+  bench_set_order(cold, g_input_count, g_input_count);
+  bench_set_order(batch_cold, batch_count, batch_count);
+
+  if (json)
+    printf(
+      "{\n  \"version\": \"%s\",\n  \"simd\": \"%s\",\n"
+      "  \"cycles\": \"%s\",\n  \"repetitions\": %u,\n  \"results\": [",
+      MATH_VERSION, bench_simd_name(), bench_rdtsc() ? "tsc" : "none",
+      repetitions);
+  else
+    printf(
+      "math %s, %s, %u repetitions\n%-18s %-34s %-5s %10s %14s %10s\n",
+      MATH_VERSION, bench_simd_name(), repetitions,
+      "header", "function", "set", "ns/op", "ops/s", "cycles/op");
+
+  for (uint32_t i = 0; i < bench_count; ++i) {
+    const bench_t *bench = g_benches + i;
+    const char *sets[2] = { "warm", "cold" };
+
+    if (filter && !strstr(bench->name, filter))
+      continue;
+
+    for (uint32_t set = 0; set < 2; ++set) {
+      bench_result_t result;
+      if (bench->batch > 1)
+        result = bench_run(
+          bench, set ? batch_cold : batch_warm, batch_count, repetitions);
+      else
+        result = bench_run(
+          bench, set ? cold : warm, g_input_count, repetitions);
+
+      if (json) {
+        printf(
+          "%s\n    { \"header\": \"%s\", \"function\": \"%s\", "
+          "\"set\": \"%s\", \"ns_per_op\": %.3f, \"ops_per_s\": %.0f, "
+          "\"cycles_per_op\": %.3f }",
+          first ? "" : ",", bench->header, bench->name, sets[set],
+          result.ns_per_op, 1e9 / result.ns_per_op, result.cycles_per_op);
+        first = 0;
+      } else
+        printf(
+          "%-18s %-34s %-5s %10.3f %14.0f %10.3f\n",
+          bench->header, bench->name, sets[set],
+          result.ns_per_op, 1e9 / result.ns_per_op, result.cycles_per_op);
+      fflush(stdout);
+    }
+  }
+
+  if (json)
+    printf("\n  ]\n}\n");
+
+  free(batch_cold);
+  free(batch_warm);
+  free(cold);
+  free(warm);
+  free(g_faces);
+  free(g_inputs);
+  return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file aabb.h
+ * @author khalilhenoud@gmail.com
+ * @brief axis aligned bounding box.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef AABB_DEFINITION_H
+#define AABB_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <float.h>
+#include <math/vector3f.h>
+
+
+// points[0] is the min corner, points[1] the max corner.
+typedef
+struct aabb_t {
+  point3f points[2];
+} aabb_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// an empty box (min > max), merging anything into it yields that thing.
+// NOTE: comparisons are used rather than fminf/fmaxf, which most compilers
+// will not turn into a single instruction because of their NaN handling.
+MATH_INLINE
+void
+aabb_set_empty(aabb_t *dst)
+{
+  vector3f_set_1f(dst->points + 0, FLT_MAX);
+  vector3f_set_1f(dst->points + 1, -FLT_MAX);
+}
+
+MATH_INLINE
+void
+merge_set_aabb_p3f(aabb_t *dst, const point3f *point)
+{
+  for (uint32_t i = 0; i < 3; ++i) {
+    float value = point->data[i];
+    float *lower = dst->points[0].data + i, *upper = dst->points[1].data + i;
+    *lower = value < *lower ? value : *lower;
+    *upper = value > *upper ? value : *upper;
+  }
+}
+
+MATH_INLINE
+void
+merge_set_aabb(aabb_t *dst, const aabb_t *src)
+{
+  for (uint32_t i = 0; i < 3; ++i) {
+    float lower = src->points[0].data[i], upper = src->points[1].data[i];
+    dst->points[0].data[i] =
+      lower < dst->points[0].data[i] ? lower : dst->points[0].data[i];
+    dst->points[1].data[i] =
+      upper > dst->points[1].data[i] ? upper : dst->points[1].data[i];
+  }
+}
+
+// grows the box by 'radius' in every direction.
+MATH_INLINE
+void
+inflate_set_aabb(aabb_t *dst, float radius)
+{
+  for (uint32_t i = 0; i < 3; ++i) {
+    dst->points[0].data[i] -= radius;
+    dst->points[1].data[i] += radius;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// returns 0 for an empty box.
+MATH_INLINE
+float
+surface_area_aabb(const aabb_t *src)
+{
+  float x = src->points[1].data[0] - src->points[0].data[0];
+  float y = src->points[1].data[1] - src->points[0].data[1];
+  float z = src->points[1].data[2] - src->points[0].data[2];
+  if (x < 0.f || y < 0.f || z < 0.f)
+    return 0.f;
+  return 2.f * (x * y + y * z + z * x);
+}
+
+// 0 if the point is inside the box.
+MATH_INLINE
+float
+distance_squared_aabb_p3f(const aabb_t *src, const point3f *point)
+{
+  float distance = 0.f;
+  for (uint32_t i = 0; i < 3; ++i) {
+    float below = src->points[0].data[i] - point->data[i];
+    float above = point->data[i] - src->points[1].data[i];
+    float d = below > above ? below : above;
+    d = d > 0.f ? d : 0.f;
+    distance += d * d;
+  }
+  return distance;
+}
+
+MATH_INLINE
+int32_t
+overlap_aabb(const aabb_t *lhs, const aabb_t *rhs)
+{
+  return
+    lhs->points[0].data[0] <= rhs->points[1].data[0] &&
+    lhs->points[1].data[0] >= rhs->points[0].data[0] &&
+    lhs->points[0].data[1] <= rhs->points[1].data[1] &&
+    lhs->points[1].data[1] >= rhs->points[0].data[1] &&
+    lhs->points[0].data[2] <= rhs->points[1].data[2] &&
+    lhs->points[1].data[2] >= rhs->points[0].data[2];
+}
+
+// 1 if 'inner' lies entirely within 'outer'.
+MATH_INLINE
+int32_t
+contains_aabb(const aabb_t *outer, const aabb_t *inner)
+{
+  return
+    outer->points[0].data[0] <= inner->points[0].data[0] &&
+    outer->points[1].data[0] >= inner->points[1].data[0] &&
+    outer->points[0].data[1] <= inner->points[0].data[1] &&
+    outer->points[1].data[1] >= inner->points[1].data[1] &&
+    outer->points[0].data[2] <= inner->points[0].data[2] &&
+    outer->points[1].data[2] >= inner->points[1].data[2];
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file broadphase.h
+ * @author khalilhenoud@gmail.com
+ * @brief sort and sweep broadphase over sphere and capsule arrays.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef BROADPHASE_DEFINITION_H
+#define BROADPHASE_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/aabb.h>
+#include <math/sphere.h>
+#include <math/capsule.h>
+#include <math/simd.h>
+
+
+// the sweep axis only changes once the spread of the centers along another
+// axis is this many times larger, switching axes costs a full sort.
+#define BROADPHASE_AXIS_HYSTERESIS 1.5f
+// the insertion sort gives up past this many moves per proxy and falls back to
+// a full sort, bodies moved too far since the last update to be worth it.
+#define BROADPHASE_MAX_MOVES 16
+
+// 32 bytes, two proxies per cache line. 'lower' and 'upper' bound the body
+// along the sweep axis, 'others' holds its bounds along the two other axes as
+// min, min, -max, -max so the sweep tests both with a single comparison.
+// 'index' is the body, spheres come first then capsules: capsule i is
+// 'sphere_count' + i.
+typedef
+struct broadphase_proxy_t {
+  float others[4];
+  float lower;
+  float upper;
+  uint32_t index;
+  uint32_t padding;
+} broadphase_proxy_t;
+
+// first < second, both use the same numbering as broadphase_proxy_t::index.
+typedef
+struct broadphase_pair_t {
+  uint32_t first;
+  uint32_t second;
+} broadphase_pair_t;
+
+// proxies are kept sorted on the lower bound along 'axis' from one update to
+// the next, bodies barely move between frames so re-sorting is close to linear.
+// NOTE: the broadphase does not own any memory.
+typedef
+struct broadphase_t {
+  broadphase_proxy_t *proxies;
+  uint32_t capacity;
+  uint32_t count;
+  uint32_t axis;
+} broadphase_t;
+
+// 'proxies' must hold as many entries as there will be bodies.
+MATH_INLINE
+void
+broadphase_init(
+  broadphase_t *broadphase,
+  broadphase_proxy_t *proxies,
+  uint32_t capacity);
+
+// refreshes the bounds of every body and restores the sort order. Changing the
+// number of bodies re-sorts everything, keep the arrays in the same order from
+// one frame to the next to benefit from the previous sort.
+MATH_INLINE
+void
+broadphase_update(
+  broadphase_t *broadphase,
+  const sphere_t *spheres,
+  uint32_t sphere_count,
+  const capsule_t *capsules,
+  uint32_t capsule_count);
+
+// writes the pairs of bodies whose bounds overlap into 'pairs', up to
+// 'capacity'. Returns the number of overlapping pairs, which can be more than
+// 'capacity'.
+MATH_INLINE
+uint32_t
+get_broadphase_pairs(
+  const broadphase_t *broadphase,
+  broadphase_pair_t *pairs,
+  uint32_t capacity);
+
+#include "broadphase.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * @file bvh.h
+ * @author khalilhenoud@gmail.com
+ * @brief bounding volume hierarchy over an array of faces.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef BVH_DEFINITION_H
+#define BVH_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/aabb.h>
+#include <math/face.h>
+#include <math/sphere.h>
+#include <math/capsule.h>
+
+
+#define BVH_BINS 16
+#define BVH_MAX_DEPTH 64
+#define BVH_MAX_LEAF_SIZE 8
+#define BVH_INVALID_INDEX 0xffffffff
+
+// 32 bytes, two nodes per cache line. Children are always allocated as a pair,
+// the right child is at 'left_first' + 1.
+typedef
+struct bvh_node_t {
+  aabb_t bounds;
+  uint32_t left_first;          // left child if count == 0, else first index.
+  uint32_t count;               // number of faces, 0 for internal nodes.
+} bvh_node_t;
+
+// NOTE: the bvh does not own any memory, 'faces' must outlive it.
+typedef
+struct bvh_t {
+  const face_t *faces;
+  uint32_t face_count;
+  bvh_node_t *nodes;
+  uint32_t node_count;
+  uint32_t *indices;            // leaves reference faces through this.
+} bvh_t;
+
+// upper bound on the number of nodes for 'face_count' faces.
+MATH_INLINE
+uint32_t
+get_bvh_max_nodes(uint32_t face_count);
+
+// builds the hierarchy using a binned surface area heuristic.
+// 'nodes' must hold get_bvh_max_nodes() entries, 'indices' and 'scratch' must
+// hold 'face_count' entries, scratch is not needed once the build returns.
+MATH_INLINE
+void
+bvh_build(
+  bvh_t *bvh,
+  const face_t *faces,
+  uint32_t face_count,
+  bvh_node_t *nodes,
+  uint32_t *indices,
+  aabb_t *scratch);
+
+////////////////////////////////////////////////////////////////////////////////
+// returns the index of the closest face to 'point' or BVH_INVALID_INDEX if the
+// bvh is empty. 'closest' and 'distance_squared' are optional.
+MATH_INLINE
+uint32_t
+get_bvh_closest_face(
+  const bvh_t *bvh,
+  const point3f *point,
+  point3f *closest,
+  float *distance_squared);
+
+// writes the indices of the faces overlapping the sphere into 'faces', up to
+// 'capacity'. Returns the number of overlapping faces, which can be more than
+// 'capacity'.
+MATH_INLINE
+uint32_t
+get_bvh_sphere_overlaps(
+  const bvh_t *bvh,
+  const sphere_t *sphere,
+  uint32_t *faces,
+  uint32_t capacity);
+
+// @see get_bvh_sphere_overlaps().
+MATH_INLINE
+uint32_t
+get_bvh_capsule_overlaps(
+  const bvh_t *bvh,
+  const capsule_t *capsule,
+  uint32_t *faces,
+  uint32_t capacity);
+
+// @see get_bvh_sphere_overlaps(), only the bounds of the faces are tested so
+// the result is a superset of the faces touching 'bounds'.
+MATH_INLINE
+uint32_t
+get_bvh_aabb_overlaps(
+  const bvh_t *bvh,
+  const aabb_t *bounds,
+  uint32_t *faces,
+  uint32_t capacity);
+
+#include "bvh.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
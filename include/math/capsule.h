@@ -15,13 +15,16 @@
 extern "C" {
 #endif
 
+#include <math/aabb.h>
+#include <math/matrix4f.h>
+#include <math/quatf.h>
 #include <math/vector3f.h>
 
 
 typedef struct segment_t segment_t;
 
 // direction is (0, 1, 0) in all cases, a transform is required to modify this.
-// NOTE: make a version of these functions that take transform into account;
+// NOTE: see the _m4f/_quatf variants below or oriented_capsule_t.
 typedef
 struct capsule_t {
   point3f center;
@@ -29,20 +32,62 @@ struct capsule_t {
   float radius;
 } capsule_t;
 
-// TODO: Provide variants with transform.
-inline
+// direction is (0, 1, 0) rotated by 'orientation', which must be unit.
+// NOTE: the members up to 'half_height' are read as consecutive floats by the
+// batch functions, keep the layout.
+typedef
+struct oriented_capsule_t {
+  point3f center;
+  quatf orientation;
+  float half_height;
+  float radius;
+} oriented_capsule_t;
+
+MATH_INLINE
 void
 get_capsule_segment(
   const capsule_t *source,
   segment_t *segment);
 
-inline
+MATH_INLINE
 void
 get_capsule_segment_loose(
   const capsule_t *source,
   point3f *a,
   point3f *b);
 
+// the segment of 'source' in its local space, moved by 'transform'. The radius
+// is unchanged, 'transform' must not scale.
+MATH_INLINE
+void
+get_capsule_segment_m4f(
+  const capsule_t *source,
+  const matrix4f *transform,
+  segment_t *segment);
+
+// 'source' rotated about its center by 'orientation', which need not be unit.
+MATH_INLINE
+void
+get_capsule_segment_quatf(
+  const capsule_t *source,
+  const quatf *orientation,
+  segment_t *segment);
+
+////////////////////////////////////////////////////////////////////////////////
+// as get_capsule_segment(), points[0] is in the -direction.
+MATH_INLINE
+void
+get_oriented_capsule_segment(
+  const oriented_capsule_t *source,
+  segment_t *segment);
+
+// the tightest box, the segment's box inflated by the radius.
+MATH_INLINE
+void
+get_oriented_capsule_aabb(
+  const oriented_capsule_t *source,
+  aabb_t *bounds);
+
 #include "capsule.impl"
 
 #ifdef __cplusplus
@@ -0,0 +1,45 @@
+/**
+ * @file capsule_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief segments and bounds of oriented capsule arrays.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_CAPSULE_BATCH_H
+#define C_CAPSULE_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/aabb.h>
+#include <math/capsule.h>
+#include <math/segment_batch.h>
+
+
+// get_oriented_capsule_segment() of every capsule, the count is the one of
+// 'segments', ready for closest_points_on_segments_soa().
+MATH_INLINE
+void
+get_oriented_capsule_segment_soa(
+  const oriented_capsule_t *capsules,
+  segment_soa_t *segments);
+
+// bounds[i] = get_oriented_capsule_aabb(capsules[i]).
+MATH_INLINE
+void
+get_oriented_capsule_aabb_array(
+  const oriented_capsule_t *capsules,
+  aabb_t *bounds,
+  uint32_t count);
+
+#include "capsule_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * @file capsule_collision.h
+ * @author khalilhenoud@gmail.com
+ * @brief capsule contacts, sweeps and collide and slide against faces.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CAPSULE_COLLISION_DEFINITION_H
+#define CAPSULE_COLLISION_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/bvh.h>
+#include <math/capsule.h>
+#include <math/face.h>
+
+
+// the sweep stops once the capsule is within this distance of a face.
+#define CAPSULE_SWEEP_TOLERANCE 1e-4f
+#define CAPSULE_SWEEP_MAX_STEPS 32
+// gap kept between the capsule and the faces it slides along, must be larger
+// than CAPSULE_SWEEP_TOLERANCE or sliding stalls on the face it just hit.
+#define CAPSULE_SLIDE_SKIN 1e-3f
+#define CAPSULE_SLIDE_MAX_ITERATIONS 4
+// candidate faces gathered from a bvh per query, a query with more candidates
+// falls back to testing every face of the bvh.
+#define CAPSULE_BVH_MAX_CANDIDATES 256
+
+typedef
+struct capsule_contact_t {
+  point3f point;                // on the face.
+  vector3f normal;              // unit, from the face towards the capsule.
+  float penetration;            // 0 when touching.
+  float time;                   // fraction of the displacement, 0 if static.
+  uint32_t face;                // index into the faces array.
+} capsule_contact_t;
+
+// NOTE: the face array forms test every face and suit small meshes, the
+// indexed forms only test faces[indices[i]] and the bvh forms gather their
+// candidates from the hierarchy. 'face' in the contacts always indexes
+// 'faces', or the faces of the bvh.
+
+// writes the contacts of the faces overlapping the capsule into 'contacts', up
+// to 'capacity'. Returns the number of overlapping faces, which can be more
+// than 'capacity'.
+// NOTE: a face going through the capsule segment is pushed along its normal,
+// the normal is zero if that face is degenerate.
+MATH_INLINE
+uint32_t
+get_capsule_faces_contacts(
+  const capsule_t *capsule,
+  const face_t *faces,
+  uint32_t face_count,
+  capsule_contact_t *contacts,
+  uint32_t capacity);
+
+MATH_INLINE
+uint32_t
+get_capsule_faces_contacts_indexed(
+  const capsule_t *capsule,
+  const face_t *faces,
+  const uint32_t *indices,
+  uint32_t index_count,
+  capsule_contact_t *contacts,
+  uint32_t capacity);
+
+MATH_INLINE
+uint32_t
+get_capsule_bvh_contacts(
+  const capsule_t *capsule,
+  const bvh_t *bvh,
+  capsule_contact_t *contacts,
+  uint32_t capacity);
+
+// moves the capsule by 'displacement' and returns 1 if it hits a face, the
+// first contact is written to 'contact'. Faces the capsule already overlaps
+// are reported at time 0, faces it touches but moves away from are ignored.
+MATH_INLINE
+int32_t
+sweep_capsule_faces(
+  const capsule_t *capsule,
+  const vector3f *displacement,
+  const face_t *faces,
+  uint32_t face_count,
+  capsule_contact_t *contact);
+
+MATH_INLINE
+int32_t
+sweep_capsule_faces_indexed(
+  const capsule_t *capsule,
+  const vector3f *displacement,
+  const face_t *faces,
+  const uint32_t *indices,
+  uint32_t index_count,
+  capsule_contact_t *contact);
+
+MATH_INLINE
+int32_t
+sweep_capsule_bvh(
+  const capsule_t *capsule,
+  const vector3f *displacement,
+  const bvh_t *bvh,
+  capsule_contact_t *contact);
+
+// bounds of every position collide_and_slide_capsule() can move the capsule
+// through, as long as it does not start out overlapping a face. The faces
+// overlapping these bounds are the candidates of the whole slide.
+MATH_INLINE
+void
+get_capsule_slide_bounds(
+  const capsule_t *capsule,
+  const vector3f *displacement,
+  aabb_t *bounds);
+
+// moves the capsule by 'displacement', sliding along the faces it hits, up to
+// CAPSULE_SLIDE_MAX_ITERATIONS times. Overlaps are pushed out along the
+// contact normal. The contacts are written to 'contacts' up to 'capacity', the
+// number of contacts is returned.
+MATH_INLINE
+uint32_t
+collide_and_slide_capsule(
+  capsule_t *capsule,
+  const vector3f *displacement,
+  const face_t *faces,
+  uint32_t face_count,
+  capsule_contact_t *contacts,
+  uint32_t capacity);
+
+// 'indices' are usually the faces overlapping get_capsule_slide_bounds(), a
+// push out of a deep overlap can move the capsule past them.
+MATH_INLINE
+uint32_t
+collide_and_slide_capsule_indexed(
+  capsule_t *capsule,
+  const vector3f *displacement,
+  const face_t *faces,
+  const uint32_t *indices,
+  uint32_t index_count,
+  capsule_contact_t *contacts,
+  uint32_t capacity);
+
+// gathers the candidates once from get_capsule_slide_bounds(), and again only
+// if a push out moves the capsule outside of them.
+MATH_INLINE
+uint32_t
+collide_and_slide_capsule_bvh(
+  capsule_t *capsule,
+  const vector3f *displacement,
+  const bvh_t *bvh,
+  capsule_contact_t *contacts,
+  uint32_t capacity);
+
+#include "capsule_collision.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,6 +21,12 @@ extern "C" {
 #include <stdint.h>
 
 
+// every function of the headers is declared MATH_INLINE. A translation unit can
+// define it before including any of them, see src/kernels_table.inl.
+#ifndef MATH_INLINE
+#define MATH_INLINE inline
+#endif
+
 #ifndef M_PI
 #define K_PI 3.14159265358979323846
 #else
@@ -0,0 +1,356 @@
+/**
+ * @file constexpr.hpp
+ * @author khalilhenoud@gmail.com
+ * @brief compile time versions of the transform constructors, constant
+ * transforms fold into static data.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CPP_CONSTEXPR_HPP
+#define CPP_CONSTEXPR_HPP
+
+#include <math/common.h>
+#include <math/cpp/matrix4f.hpp>
+#include <math/cpp/quatf.hpp>
+#include <math/cpp/vector3f.hpp>
+
+
+// every function here gives the same result as its C counterpart (within
+// float rounding, the trig is evaluated in double) and can initialize a
+// constexpr variable:
+//   constexpr math::mat4 y_up = math::cx::rotation_x(-K_PI / 2.f);
+// NOTE: written to the C++11 constexpr rules (a single return, recursion for
+// loops), they are no faster than the C functions when called at runtime.
+namespace math {
+namespace cx {
+
+namespace detail {
+
+constexpr double k_two_pi = 2.0 * K_PI;
+
+// 'x' wrapped to [-pi, pi].
+constexpr
+double
+wrap_pi(double x)
+{
+  return x - k_two_pi * (double)(long long)(
+    x / k_two_pi + (x >= 0.0 ? 0.5 : -0.5));
+}
+
+// taylor series of sin up to x^21 for |x| <= pi / 2, error under 1e-15.
+constexpr
+double
+sin_series(double x2, double term, int n)
+{
+  return n > 21 ?
+    0.0 :
+    term + sin_series(x2, -term * x2 / ((n + 1) * (n + 2)), n + 2);
+}
+
+constexpr
+double
+sin_half_pi(double x)
+{
+  return sin_series(x * x, x, 1);
+}
+
+// sin(x) = sin(pi - x) folds [-pi, pi] into [-pi / 2, pi / 2].
+constexpr
+double
+sin_wrapped(double x)
+{
+  return
+    x > K_PI / 2.0 ? sin_half_pi(K_PI - x) :
+    x < -K_PI / 2.0 ? sin_half_pi(-K_PI - x) :
+    sin_half_pi(x);
+}
+
+constexpr
+double
+sqrt_newton(double x, double guess, int steps)
+{
+  return steps == 0 || guess == 0.0 ?
+    guess :
+    sqrt_newton(x, 0.5 * (guess + x / guess), steps - 1);
+}
+
+// sqrt(x) = 2 * sqrt(x / 4) brings a positive finite 'x' into [0.25, 4), where
+// newton's method from 1 converges in 6 steps. Scaling by 4 is exact, the
+// recursion is at most 75 deep over the float range.
+constexpr
+double
+sqrt_scaled(double x)
+{
+  return
+    x >= 4.0 ? 2.0 * sqrt_scaled(x * 0.25) :
+    x < 0.25 ? 0.5 * sqrt_scaled(x * 4.0) :
+    sqrt_newton(x, 1.0, 8);
+}
+
+constexpr
+float
+dot_row_column(const mat4 &lhs, const mat4 &rhs, int row, int column)
+{
+  return
+    lhs[row * 4 + 0] * rhs[0 * 4 + column] +
+    lhs[row * 4 + 1] * rhs[1 * 4 + column] +
+    lhs[row * 4 + 2] * rhs[2 * 4 + column] +
+    lhs[row * 4 + 3] * rhs[3 * 4 + column];
+}
+
+// matrix4f_set_axisangle() closed form for a unit 'axis':
+// cos * I + (1 - cos) * axis * axis^T + sin * cross(axis).
+constexpr
+mat4
+axis_angle_unit(float x, float y, float z, float c, float s)
+{
+  return mat4(
+    c + (1.f - c) * x * x, (1.f - c) * x * y - s * z,
+    (1.f - c) * x * z + s * y, 0.f,
+    (1.f - c) * y * x + s * z, c + (1.f - c) * y * y,
+    (1.f - c) * y * z - s * x, 0.f,
+    (1.f - c) * z * x - s * y, (1.f - c) * z * y + s * x,
+    c + (1.f - c) * z * z, 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+constexpr
+mat4
+axis_angle_scaled(const vec3 &axis, float scale, float c, float s)
+{
+  return axis_angle_unit(
+    axis[0] * scale, axis[1] * scale, axis[2] * scale, c, s);
+}
+
+// quatf_to_matrix4f() once 'src' is unit.
+constexpr
+mat4
+quat_to_matrix_unit(float w, float x, float y, float z)
+{
+  return mat4(
+    1.f - 2.f * y * y - 2.f * z * z, 2.f * x * y - 2.f * z * w,
+    2.f * x * z + 2.f * y * w, 0.f,
+    2.f * x * y + 2.f * z * w, 1.f - 2.f * x * x - 2.f * z * z,
+    2.f * y * z - 2.f * x * w, 0.f,
+    2.f * x * z - 2.f * y * w, 2.f * y * z + 2.f * x * w,
+    1.f - 2.f * x * x - 2.f * y * y, 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+constexpr
+mat4
+quat_to_matrix_scaled(const quat &src, float scale)
+{
+  return quat_to_matrix_unit(
+    src[QUAT_S] * scale,
+    src[QUAT_X] * scale,
+    src[QUAT_Y] * scale,
+    src[QUAT_Z] * scale);
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+constexpr
+float
+sin(float angle_radian)
+{
+  return (float)detail::sin_wrapped(detail::wrap_pi(angle_radian));
+}
+
+constexpr
+float
+cos(float angle_radian)
+{
+  return (float)detail::sin_wrapped(
+    detail::wrap_pi(angle_radian + K_PI / 2.0));
+}
+
+constexpr
+float
+sqrt(float value)
+{
+  return
+    value <= 0.f ? 0.f :
+    value > FLT_MAX ? value :
+    (float)detail::sqrt_scaled(value);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+constexpr
+mat4
+identity()
+{
+  return mat4(
+    1.f, 0.f, 0.f, 0.f,
+    0.f, 1.f, 0.f, 0.f,
+    0.f, 0.f, 1.f, 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+// @see matrix4f_rotation_x().
+constexpr
+mat4
+rotation_x(float angle_radian)
+{
+  return mat4(
+    1.f, 0.f, 0.f, 0.f,
+    0.f, cos(angle_radian), -sin(angle_radian), 0.f,
+    0.f, sin(angle_radian), cos(angle_radian), 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+// @see matrix4f_rotation_y().
+constexpr
+mat4
+rotation_y(float angle_radian)
+{
+  return mat4(
+    cos(angle_radian), 0.f, sin(angle_radian), 0.f,
+    0.f, 1.f, 0.f, 0.f,
+    -sin(angle_radian), 0.f, cos(angle_radian), 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+// @see matrix4f_rotation_z().
+constexpr
+mat4
+rotation_z(float angle_radian)
+{
+  return mat4(
+    cos(angle_radian), -sin(angle_radian), 0.f, 0.f,
+    sin(angle_radian), cos(angle_radian), 0.f, 0.f,
+    0.f, 0.f, 1.f, 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+// @see matrix4f_translation().
+constexpr
+mat4
+translation(float x, float y, float z)
+{
+  return mat4(
+    1.f, 0.f, 0.f, x,
+    0.f, 1.f, 0.f, y,
+    0.f, 0.f, 1.f, z,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+// @see matrix4f_scale().
+constexpr
+mat4
+scale(float x, float y, float z)
+{
+  return mat4(
+    x, 0.f, 0.f, 0.f,
+    0.f, y, 0.f, 0.f,
+    0.f, 0.f, z, 0.f,
+    0.f, 0.f, 0.f, 1.f);
+}
+
+// @see matrix4f_set_axisangle(), 'axis' is normalized.
+constexpr
+mat4
+axis_angle(const vec3 &axis, float angle_radian)
+{
+  return detail::axis_angle_scaled(
+    axis,
+    1.f / sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]),
+    cos(angle_radian),
+    sin(angle_radian));
+}
+
+// @see mult_m4f().
+constexpr
+mat4
+mult(const mat4 &lhs, const mat4 &rhs)
+{
+  return mat4(
+    detail::dot_row_column(lhs, rhs, 0, 0),
+    detail::dot_row_column(lhs, rhs, 0, 1),
+    detail::dot_row_column(lhs, rhs, 0, 2),
+    detail::dot_row_column(lhs, rhs, 0, 3),
+    detail::dot_row_column(lhs, rhs, 1, 0),
+    detail::dot_row_column(lhs, rhs, 1, 1),
+    detail::dot_row_column(lhs, rhs, 1, 2),
+    detail::dot_row_column(lhs, rhs, 1, 3),
+    detail::dot_row_column(lhs, rhs, 2, 0),
+    detail::dot_row_column(lhs, rhs, 2, 1),
+    detail::dot_row_column(lhs, rhs, 2, 2),
+    detail::dot_row_column(lhs, rhs, 2, 3),
+    detail::dot_row_column(lhs, rhs, 3, 0),
+    detail::dot_row_column(lhs, rhs, 3, 1),
+    detail::dot_row_column(lhs, rhs, 3, 2),
+    detail::dot_row_column(lhs, rhs, 3, 3));
+}
+
+// @see mult_m4f_p3f().
+constexpr
+point3
+transform_point(const mat4 &lhs, const point3 &rhs)
+{
+  return point3(
+    lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2] + lhs[3],
+    lhs[4] * rhs[0] + lhs[5] * rhs[1] + lhs[6] * rhs[2] + lhs[7],
+    lhs[8] * rhs[0] + lhs[9] * rhs[1] + lhs[10] * rhs[2] + lhs[11]);
+}
+
+// @see mult_m4f_v3f().
+constexpr
+vec3
+transform_vector(const mat4 &lhs, const vec3 &rhs)
+{
+  return vec3(
+    lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2],
+    lhs[4] * rhs[0] + lhs[5] * rhs[1] + lhs[6] * rhs[2],
+    lhs[8] * rhs[0] + lhs[9] * rhs[1] + lhs[10] * rhs[2]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// @see quatf_set_from_axis_angle(), 'axis' must be unit.
+constexpr
+quat
+quat_from_axis_angle(const vec3 &axis, float angle_radian)
+{
+  return quat(
+    cos(angle_radian / 2.f),
+    sin(angle_radian / 2.f) * axis[0],
+    sin(angle_radian / 2.f) * axis[1],
+    sin(angle_radian / 2.f) * axis[2]);
+}
+
+// @see mult_quatf().
+constexpr
+quat
+mult(const quat &lhs, const quat &rhs)
+{
+  return quat(
+    lhs[QUAT_S] * rhs[QUAT_S] - lhs[QUAT_X] * rhs[QUAT_X] -
+    lhs[QUAT_Y] * rhs[QUAT_Y] - lhs[QUAT_Z] * rhs[QUAT_Z],
+    lhs[QUAT_S] * rhs[QUAT_X] + lhs[QUAT_X] * rhs[QUAT_S] +
+    lhs[QUAT_Y] * rhs[QUAT_Z] - lhs[QUAT_Z] * rhs[QUAT_Y],
+    lhs[QUAT_S] * rhs[QUAT_Y] + lhs[QUAT_Y] * rhs[QUAT_S] +
+    lhs[QUAT_Z] * rhs[QUAT_X] - lhs[QUAT_X] * rhs[QUAT_Z],
+    lhs[QUAT_S] * rhs[QUAT_Z] + lhs[QUAT_Z] * rhs[QUAT_S] +
+    lhs[QUAT_X] * rhs[QUAT_Y] - lhs[QUAT_Y] * rhs[QUAT_X]);
+}
+
+// @see quatf_to_matrix4f(), 'src' is normalized.
+constexpr
+mat4
+to_matrix(const quat &src)
+{
+  return detail::quat_to_matrix_scaled(
+    src,
+    1.f / sqrt(
+      src[QUAT_S] * src[QUAT_S] + src[QUAT_X] * src[QUAT_X] +
+      src[QUAT_Y] * src[QUAT_Y] + src[QUAT_Z] * src[QUAT_Z]));
+}
+
+}
+}
+
+#endif
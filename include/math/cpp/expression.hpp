@@ -0,0 +1,204 @@
+/**
+ * @file expression.hpp
+ * @author khalilhenoud@gmail.com
+ * @brief expression templates shared by the C++ wrappers, element wise
+ * arithmetic over arrays of N floats evaluated in a single pass.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CPP_EXPRESSION_HPP
+#define CPP_EXPRESSION_HPP
+
+#include <math.h>
+#include <stdint.h>
+
+
+namespace math {
+
+// every operand of an element wise expression derives from expr<E, N>. The
+// operators only build nodes, element 'i' of the whole expression is computed
+// when the result is assigned, so 'a + (b - a) * t' is one loop with no
+// intermediate vector.
+// NOTE: vec3, quat and mat4 operands are held by reference, do not keep an
+// expression in an 'auto' past the statement that built it.
+// NOTE: element 'i' only reads element 'i' of its operands, assigning an
+// expression to one of its own operands ('v = v * 2.f') is safe.
+template <typename E, uint32_t N>
+struct expr {
+  const E &
+  self() const
+  {
+    return static_cast<const E &>(*this);
+  }
+};
+
+// how a node stores an operand, by value for nodes (a few floats and
+// references), specialized to a const reference for the wrapper types.
+template <typename T>
+struct expr_storage {
+  typedef T type;
+};
+
+template <typename E, uint32_t N>
+inline
+void
+expr_assign(float *dst, const expr<E, N> &src)
+{
+  const E &e = src.self();
+  for (uint32_t i = 0; i < N; ++i)
+    dst[i] = e[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+struct op_add {
+  static float apply(float lhs, float rhs) { return lhs + rhs; }
+};
+
+struct op_sub {
+  static float apply(float lhs, float rhs) { return lhs - rhs; }
+};
+
+struct op_mult {
+  static float apply(float lhs, float rhs) { return lhs * rhs; }
+};
+
+struct op_div {
+  static float apply(float lhs, float rhs) { return lhs / rhs; }
+};
+
+template <typename L, typename R, typename OP, uint32_t N>
+struct expr_binary : expr<expr_binary<L, R, OP, N>, N> {
+  typename expr_storage<L>::type lhs;
+  typename expr_storage<R>::type rhs;
+
+  expr_binary(const L &l, const R &r) : lhs(l), rhs(r) {}
+
+  float
+  operator[](uint32_t i) const
+  {
+    return OP::apply(lhs[i], rhs[i]);
+  }
+};
+
+template <typename L, typename OP, uint32_t N>
+struct expr_scalar : expr<expr_scalar<L, OP, N>, N> {
+  typename expr_storage<L>::type lhs;
+  float rhs;
+
+  expr_scalar(const L &l, float r) : lhs(l), rhs(r) {}
+
+  float
+  operator[](uint32_t i) const
+  {
+    return OP::apply(lhs[i], rhs);
+  }
+};
+
+template <typename L, uint32_t N>
+struct expr_negate : expr<expr_negate<L, N>, N> {
+  typename expr_storage<L>::type lhs;
+
+  explicit expr_negate(const L &l) : lhs(l) {}
+
+  float
+  operator[](uint32_t i) const
+  {
+    return -lhs[i];
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename L, typename R, uint32_t N>
+inline
+expr_binary<L, R, op_add, N>
+operator+(const expr<L, N> &lhs, const expr<R, N> &rhs)
+{
+  return expr_binary<L, R, op_add, N>(lhs.self(), rhs.self());
+}
+
+template <typename L, typename R, uint32_t N>
+inline
+expr_binary<L, R, op_sub, N>
+operator-(const expr<L, N> &lhs, const expr<R, N> &rhs)
+{
+  return expr_binary<L, R, op_sub, N>(lhs.self(), rhs.self());
+}
+
+template <typename L, uint32_t N>
+inline
+expr_negate<L, N>
+operator-(const expr<L, N> &lhs)
+{
+  return expr_negate<L, N>(lhs.self());
+}
+
+template <typename L, uint32_t N>
+inline
+expr_scalar<L, op_mult, N>
+operator*(const expr<L, N> &lhs, float scale)
+{
+  return expr_scalar<L, op_mult, N>(lhs.self(), scale);
+}
+
+template <typename R, uint32_t N>
+inline
+expr_scalar<R, op_mult, N>
+operator*(float scale, const expr<R, N> &rhs)
+{
+  return expr_scalar<R, op_mult, N>(rhs.self(), scale);
+}
+
+template <typename L, uint32_t N>
+inline
+expr_scalar<L, op_div, N>
+operator/(const expr<L, N> &lhs, float scale)
+{
+  return expr_scalar<L, op_div, N>(lhs.self(), scale);
+}
+
+// src + (dst - src) * t, the same as lerp_v3f() and lerp_quatf().
+template <typename L, typename R, uint32_t N>
+inline
+expr_binary<
+  L, expr_scalar<expr_binary<R, L, op_sub, N>, op_mult, N>, op_add, N>
+lerp(const expr<L, N> &src, const expr<R, N> &dst, float t)
+{
+  return src + (dst - src) * t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename L, typename R, uint32_t N>
+inline
+float
+dot(const expr<L, N> &lhs, const expr<R, N> &rhs)
+{
+  const L &l = lhs.self();
+  const R &r = rhs.self();
+  float result = l[0] * r[0];
+  for (uint32_t i = 1; i < N; ++i)
+    result += l[i] * r[i];
+  return result;
+}
+
+template <typename E, uint32_t N>
+inline
+float
+length_squared(const expr<E, N> &src)
+{
+  return dot(src, src);
+}
+
+template <typename E, uint32_t N>
+inline
+float
+length(const expr<E, N> &src)
+{
+  return sqrtf(dot(src, src));
+}
+
+}
+
+#endif
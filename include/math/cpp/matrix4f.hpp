@@ -0,0 +1,185 @@
+/**
+ * @file matrix4f.hpp
+ * @author khalilhenoud@gmail.com
+ * @brief C++ interface over matrix4f.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CPP_MATRIX4F_HPP
+#define CPP_MATRIX4F_HPP
+
+#include <math/matrix4f.h>
+#include <math/cpp/expression.hpp>
+#include <math/cpp/vector3f.hpp>
+
+
+namespace math {
+
+struct mat4;
+
+template <>
+struct expr_storage<mat4> {
+  typedef const mat4 &type;
+};
+
+// element wise operators (+, -, scale, lerp) are expressions, the matrix
+// product is evaluated right away with mult_m4f().
+// NOTE: points and vectors share vec3, use transform_point() and
+// transform_vector() instead of an operator.
+struct mat4 : matrix4f, expr<mat4, 16> {
+  mat4() {}
+
+  // row major, in M4_RC_XX order.
+  constexpr mat4(
+    float m00, float m01, float m02, float m03,
+    float m10, float m11, float m12, float m13,
+    float m20, float m21, float m22, float m23,
+    float m30, float m31, float m32, float m33)
+    : matrix4f{ {
+      m00, m01, m02, m03,
+      m10, m11, m12, m13,
+      m20, m21, m22, m23,
+      m30, m31, m32, m33 } }
+    , expr<mat4, 16>() {}
+
+  constexpr mat4(const matrix4f &src) : matrix4f(src), expr<mat4, 16>() {}
+
+  template <typename E>
+  mat4(const expr<E, 16> &src)
+  {
+    expr_assign(data, src);
+  }
+
+  template <typename E>
+  mat4 &
+  operator=(const expr<E, 16> &src)
+  {
+    expr_assign(data, src);
+    return *this;
+  }
+
+  mat4 &
+  operator*=(const mat4 &rhs)
+  {
+    mult_set_m4f(this, &rhs);
+    return *this;
+  }
+
+  constexpr
+  float
+  operator[](uint32_t i) const
+  {
+    return data[i];
+  }
+
+  float &
+  operator[](uint32_t i)
+  {
+    return data[i];
+  }
+
+  // M4_RC_XX order, row major.
+  constexpr
+  float
+  operator()(uint32_t row, uint32_t column) const
+  {
+    return data[row * 4 + column];
+  }
+
+  float &
+  operator()(uint32_t row, uint32_t column)
+  {
+    return data[row * 4 + column];
+  }
+
+  static
+  mat4
+  identity()
+  {
+    mat4 result;
+    matrix4f_set_identity(&result);
+    return result;
+  }
+
+  static
+  mat4
+  translation(const vec3 &offset)
+  {
+    mat4 result;
+    matrix4f_translation(
+      &result, offset.data[0], offset.data[1], offset.data[2]);
+    return result;
+  }
+
+  static
+  mat4
+  scale(const vec3 &factors)
+  {
+    mat4 result;
+    matrix4f_scale(&result, factors.data[0], factors.data[1], factors.data[2]);
+    return result;
+  }
+
+  static
+  mat4
+  axis_angle(const vec3 &axis, float angle_radian)
+  {
+    mat4 result;
+    matrix4f_set_axisangle(&result, &axis, angle_radian);
+    return result;
+  }
+};
+
+static_assert(
+  sizeof(mat4) == sizeof(matrix4f), "mat4 must have the layout of matrix4f!");
+
+////////////////////////////////////////////////////////////////////////////////
+inline
+mat4
+operator*(const mat4 &lhs, const mat4 &rhs)
+{
+  return mult_m4f(&lhs, &rhs);
+}
+
+inline
+point3
+transform_point(const mat4 &lhs, const point3 &rhs)
+{
+  return mult_m4f_p3f(&lhs, &rhs);
+}
+
+// ignores the translation.
+inline
+vec3
+transform_vector(const mat4 &lhs, const vec3 &rhs)
+{
+  return mult_m4f_v3f(&lhs, &rhs);
+}
+
+inline
+mat4
+transpose(const mat4 &src)
+{
+  return transpose_m4f(&src);
+}
+
+inline
+mat4
+inverse(const mat4 &src)
+{
+  return inverse_m4f(&src);
+}
+
+inline
+float
+determinant(const mat4 &src)
+{
+  return determinant_m4f(&src);
+}
+
+}
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * @file quatf.hpp
+ * @author khalilhenoud@gmail.com
+ * @brief C++ interface over quatf.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CPP_QUATF_HPP
+#define CPP_QUATF_HPP
+
+#include <math/quatf.h>
+#include <math/cpp/expression.hpp>
+#include <math/cpp/matrix4f.hpp>
+#include <math/cpp/vector3f.hpp>
+
+
+namespace math {
+
+struct quat;
+
+template <>
+struct expr_storage<quat> {
+  typedef const quat &type;
+};
+
+// element wise operators (+, -, scale, lerp, dot) are expressions, the
+// quaternion product is evaluated right away.
+struct quat : quatf, expr<quat, 4> {
+  quat() {}
+
+  constexpr quat(float s, float x, float y, float z)
+    : quatf{ { s, x, y, z } }, expr<quat, 4>() {}
+
+  constexpr quat(const quatf &src) : quatf(src), expr<quat, 4>() {}
+
+  template <typename E>
+  quat(const expr<E, 4> &src)
+  {
+    expr_assign(data, src);
+  }
+
+  template <typename E>
+  quat &
+  operator=(const expr<E, 4> &src)
+  {
+    expr_assign(data, src);
+    return *this;
+  }
+
+  quat &
+  operator*=(const quat &rhs)
+  {
+    mult_set_quatf(this, &rhs);
+    return *this;
+  }
+
+  constexpr
+  float
+  operator[](uint32_t i) const
+  {
+    return data[i];
+  }
+
+  float &
+  operator[](uint32_t i)
+  {
+    return data[i];
+  }
+
+  static
+  quat
+  identity()
+  {
+    quat result;
+    quatf_set_identity(&result);
+    return result;
+  }
+
+  static
+  quat
+  from_axis_angle(const vec3 &axis, float angle_radian)
+  {
+    quat result;
+    quatf_set_from_axis_angle(&result, &axis, angle_radian);
+    return result;
+  }
+};
+
+static_assert(
+  sizeof(quat) == sizeof(quatf), "quat must have the layout of quatf!");
+
+////////////////////////////////////////////////////////////////////////////////
+inline
+quat
+operator*(const quat &lhs, const quat &rhs)
+{
+  return mult_quatf(&lhs, &rhs);
+}
+
+// rotates 'rhs', see mult_quatf_v3f().
+inline
+vec3
+operator*(const quat &lhs, const vec3 &rhs)
+{
+  return mult_quatf_v3f(&lhs, &rhs);
+}
+
+inline
+quat
+conjugate(const quat &src)
+{
+  return conjugate_quatf(&src);
+}
+
+inline
+quat
+inverse(const quat &src)
+{
+  return inverse_quatf(&src);
+}
+
+inline
+quat
+normalize(quat src)
+{
+  quatf_set_normalize(&src);
+  return src;
+}
+
+inline
+quat
+slerp(const quat &src, const quat &dst, float t)
+{
+  return slerp_quatf(src, dst, t);
+}
+
+inline
+mat4
+to_matrix(const quat &src)
+{
+  return quatf_to_matrix4f(src);
+}
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * @file shapes.hpp
+ * @author khalilhenoud@gmail.com
+ * @brief C++ interface over segment_t, face_t and capsule_t.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CPP_SHAPES_HPP
+#define CPP_SHAPES_HPP
+
+#include <stddef.h>
+#include <math/capsule.h>
+#include <math/face.h>
+#include <math/segment.h>
+#include <math/cpp/vector3f.hpp>
+
+
+namespace math {
+
+struct segment : segment_t {
+  segment() {}
+
+  segment(const point3 &a, const point3 &b)
+  {
+    points[0] = a;
+    points[1] = b;
+  }
+
+  segment(const segment_t &src) : segment_t(src) {}
+
+  point3
+  closest_point(const point3 &point) const
+  {
+    return closest_point_on_segment(&point, this);
+  }
+
+  // returns the squared distance, see closest_points_on_segments().
+  float
+  closest_points(
+    const segment &other,
+    point3 *on_this = NULL,
+    point3 *on_other = NULL) const
+  {
+    return closest_points_on_segments(this, &other, on_this, on_other);
+  }
+};
+
+struct face : face_t {
+  face() {}
+
+  face(const point3 &a, const point3 &b, const point3 &c)
+  {
+    points[0] = a;
+    points[1] = b;
+    points[2] = c;
+  }
+
+  face(const face_t &src) : face_t(src) {}
+
+  // zero if the face is degenerate, see get_face_normal_safe().
+  vec3
+  normal() const
+  {
+    vec3 result;
+    get_face_normal_safe(this, &result);
+    return result;
+  }
+
+  point3
+  closest_point(const point3 &point) const
+  {
+    return closest_point_on_face(&point, this);
+  }
+
+  // returns the squared distance, see closest_points_segment_face().
+  float
+  closest_points(
+    const segment &target,
+    point3 *on_segment = NULL,
+    point3 *on_face = NULL) const
+  {
+    return closest_points_segment_face(&target, this, on_segment, on_face);
+  }
+};
+
+struct capsule : capsule_t {
+  capsule() {}
+
+  capsule(const point3 &center_, float half_height_, float radius_)
+  {
+    center = center_;
+    half_height = half_height_;
+    radius = radius_;
+  }
+
+  capsule(const capsule_t &src) : capsule_t(src) {}
+
+  segment
+  get_segment() const
+  {
+    segment result;
+    get_capsule_segment(this, &result);
+    return result;
+  }
+};
+
+static_assert(
+  sizeof(segment) == sizeof(segment_t) &&
+  sizeof(face) == sizeof(face_t) &&
+  sizeof(capsule) == sizeof(capsule_t),
+  "the shapes must have the layout of their C types!");
+
+}
+
+#endif
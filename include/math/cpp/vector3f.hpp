@@ -0,0 +1,133 @@
+/**
+ * @file vector3f.hpp
+ * @author khalilhenoud@gmail.com
+ * @brief C++ interface over vector3f.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef CPP_VECTOR3F_HPP
+#define CPP_VECTOR3F_HPP
+
+#include <math/vector3f.h>
+#include <math/cpp/expression.hpp>
+
+
+namespace math {
+
+struct vec3;
+
+template <>
+struct expr_storage<vec3> {
+  typedef const vec3 &type;
+};
+
+// a vector3f with operators, converts both ways with the C type and can be
+// passed as a 'vector3f *' to the C api.
+// NOTE: left uninitialized by the default constructor, like the C type.
+struct vec3 : vector3f, expr<vec3, 3> {
+  vec3() {}
+
+  constexpr vec3(float x, float y, float z)
+    : vector3f{ { x, y, z } }, expr<vec3, 3>() {}
+
+  constexpr explicit vec3(float value)
+    : vector3f{ { value, value, value } }, expr<vec3, 3>() {}
+
+  constexpr vec3(const vector3f &src) : vector3f(src), expr<vec3, 3>() {}
+
+  template <typename E>
+  vec3(const expr<E, 3> &src)
+  {
+    expr_assign(data, src);
+  }
+
+  template <typename E>
+  vec3 &
+  operator=(const expr<E, 3> &src)
+  {
+    expr_assign(data, src);
+    return *this;
+  }
+
+  template <typename E>
+  vec3 &
+  operator+=(const expr<E, 3> &src)
+  {
+    return *this = *this + src;
+  }
+
+  template <typename E>
+  vec3 &
+  operator-=(const expr<E, 3> &src)
+  {
+    return *this = *this - src;
+  }
+
+  vec3 &
+  operator*=(float scale)
+  {
+    return *this = *this * scale;
+  }
+
+  vec3 &
+  operator/=(float scale)
+  {
+    return *this = *this / scale;
+  }
+
+  constexpr
+  float
+  operator[](uint32_t i) const
+  {
+    return data[i];
+  }
+
+  float &
+  operator[](uint32_t i)
+  {
+    return data[i];
+  }
+};
+
+static_assert(
+  sizeof(vec3) == sizeof(vector3f), "vec3 must have the layout of vector3f!");
+
+typedef vec3 point3;
+
+////////////////////////////////////////////////////////////////////////////////
+// cross products read every element of their operands, the result is a value.
+inline
+vec3
+cross(const vec3 &lhs, const vec3 &rhs)
+{
+  return cross_product_v3f(&lhs, &rhs);
+}
+
+inline
+vec3
+normalize(const vec3 &src)
+{
+  return normalize_v3f(&src);
+}
+
+// see normalize_v3f_mp() and normalize_v3f_np().
+inline
+vec3
+normalize_mp(const vec3 &src)
+{
+  return normalize_v3f_mp(&src);
+}
+
+inline
+vec3
+normalize_np(const vec3 &src)
+{
+  return normalize_v3f_np(&src);
+}
+
+}
+
+#endif
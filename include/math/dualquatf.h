@@ -0,0 +1,207 @@
+/**
+ * @file dualquatf.h
+ * @author khalilhenoud@gmail.com
+ * @brief unit dual quaternion, a rotation then a translation in 8 floats.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_DUALQUATF_H
+#define C_DUALQUATF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <assert.h>
+#include <string.h>
+#include <math/matrix4f.h>
+#include <math/quatf.h>
+#include <math/vector3f.h>
+
+
+// 'real' is the rotation, 'dual' is 0.5 * translation * real with the
+// translation as a pure quaternion.
+// NOTE: points are transformed the same way mult_m4f_p3f() transforms them with
+// the matrix returned by dualquatf_to_matrix4f(), rotation first.
+typedef
+struct dualquatf {
+  quatf real;
+  quatf dual;
+} dualquatf;
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+void
+dualquatf_set_identity(dualquatf *dst)
+{
+  quatf_set_identity(&dst->real);
+  quatf_set_4f(&dst->dual, 0.f, 0.f, 0.f, 0.f);
+}
+
+// 'rotation' must be unit.
+MATH_INLINE
+void
+dualquatf_set_from_quatf_v3f(
+  dualquatf *dst,
+  const quatf *rotation,
+  const vector3f *translation)
+{
+  quatf pure;
+  quatf_set_4f(
+    &pure,
+    0.f, translation->data[0], translation->data[1], translation->data[2]);
+  dst->real = *rotation;
+  dst->dual = mult_quatf(&pure, rotation);
+  mult_set_quatf_f(&dst->dual, 0.5f);
+}
+
+// 'from' must be a rotation and a translation, scale and shear are lost.
+// NOTE: quatf_set_from_rotation_matrix4f() returns the conjugate of the
+// quaternion quatf_to_matrix4f() takes, it is conjugated back so the round
+// trip through dualquatf_to_matrix4f() gives 'from'.
+MATH_INLINE
+void
+dualquatf_set_from_matrix4f(dualquatf *dst, const matrix4f *from)
+{
+  quatf rotation;
+  vector3f translation;
+  quatf_set_identity(&rotation);
+  quatf_set_from_rotation_matrix4f(&rotation, from);
+  conjugate_set_quatf(&rotation);
+  quatf_set_normalize(&rotation);
+  vector3f_set_3f(
+    &translation,
+    from->data[M4_RC_03], from->data[M4_RC_13], from->data[M4_RC_23]);
+  dualquatf_set_from_quatf_v3f(dst, &rotation, &translation);
+}
+
+// 2 * dual * conjugate(real), divided by |real|^2 in case it is not unit.
+MATH_INLINE
+vector3f
+get_dualquatf_translation(const dualquatf *src)
+{
+  quatf conjugate = conjugate_quatf(&src->real);
+  quatf translation = mult_quatf(&src->dual, &conjugate);
+  float scale = 2.f / length_squared_quatf(&src->real);
+  vector3f result;
+  vector3f_set_3f(
+    &result,
+    translation.data[QUAT_X] * scale,
+    translation.data[QUAT_Y] * scale,
+    translation.data[QUAT_Z] * scale);
+  return result;
+}
+
+MATH_INLINE
+matrix4f
+dualquatf_to_matrix4f(dualquatf src)
+{
+  matrix4f result = quatf_to_matrix4f(src.real);
+  vector3f translation = get_dualquatf_translation(&src);
+  result.data[M4_RC_03] = translation.data[0];
+  result.data[M4_RC_13] = translation.data[1];
+  result.data[M4_RC_23] = translation.data[2];
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// scales both parts so the rotation is unit, a zero rotation is left as is.
+MATH_INLINE
+void
+dualquatf_set_normalize(dualquatf *dst)
+{
+  float length_squared = length_squared_quatf(&dst->real);
+  if (
+    length_squared >
+    EPSILON_FLOAT_MIN_PRECISION * EPSILON_FLOAT_MIN_PRECISION) {
+    float scale = 1.f / sqrtf(length_squared);
+    mult_set_quatf_f(&dst->real, scale);
+    mult_set_quatf_f(&dst->dual, scale);
+  }
+}
+
+// applies 'rhs' then 'lhs', like mult_m4f().
+MATH_INLINE
+dualquatf
+mult_dualquatf(const dualquatf *lhs, const dualquatf *rhs)
+{
+  dualquatf result;
+  quatf cross = mult_quatf(&lhs->dual, &rhs->real);
+  result.real = mult_quatf(&lhs->real, &rhs->real);
+  result.dual = mult_quatf(&lhs->real, &rhs->dual);
+  add_set_quatf(&result.dual, &cross);
+  return result;
+}
+
+MATH_INLINE
+void
+mult_set_dualquatf(dualquatf *dst, const dualquatf *rhs)
+{
+  *dst = mult_dualquatf(dst, rhs);
+}
+
+// the inverse of a unit dual quaternion.
+MATH_INLINE
+dualquatf
+conjugate_dualquatf(const dualquatf *src)
+{
+  dualquatf result;
+  result.real = conjugate_quatf(&src->real);
+  result.dual = conjugate_quatf(&src->dual);
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// rotates by the normalized 'real' part, the dual part is ignored. The
+// transforms do not need a unit dual quaternion, only a non zero rotation.
+MATH_INLINE
+vector3f
+mult_dualquatf_v3f(const dualquatf *src, const vector3f *vec)
+{
+  return mult_quatf_v3f(&src->real, vec);
+}
+
+MATH_INLINE
+point3f
+mult_dualquatf_p3f(const dualquatf *src, const point3f *point)
+{
+  point3f result = mult_dualquatf_v3f(src, point);
+  vector3f translation = get_dualquatf_translation(src);
+  add_set_v3f(&result, &translation);
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// dual quaternion linear blending, the weighted sum of 'src' normalized. Each
+// element is flipped onto the hemisphere of src[0] first so the blend takes
+// the shorter path, the weights do not need to add up to 1.
+MATH_INLINE
+dualquatf
+blend_dualquatf(const dualquatf *src, const float *weights, uint32_t count)
+{
+  dualquatf result;
+  assert(src != NULL && weights != NULL && count > 0);
+
+  memset(&result, 0, sizeof(result));
+  for (uint32_t i = 0; i < count; ++i) {
+    float weight = weights[i];
+    if (dot_product_quatf(&src[0].real, &src[i].real) < 0.f)
+      weight = -weight;
+    for (uint32_t j = 0; j < 4; ++j) {
+      result.real.data[j] += src[i].real.data[j] * weight;
+      result.dual.data[j] += src[i].dual.data[j] * weight;
+    }
+  }
+
+  dualquatf_set_normalize(&result);
+  return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * @file dualquatf_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief dual quaternion skinning of vertex arrays.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_DUALQUATF_BATCH_H
+#define C_DUALQUATF_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/dualquatf.h>
+#include <math/quatf_batch.h>
+#include <math/simd.h>
+
+
+// skins 'count' vertices with dual quaternion linear blending, vertex i is
+// influenced by bones[indices[i * influences + k]] with the weight
+// weights[i * influences + k] for k in [0, influences). The bones are
+// blended as in blend_dualquatf() with the first influence as reference, so
+// it should be the one with the largest weight, unused influences can be
+// padded with a 0 weight.
+// 'normals' and 'dst_normals' can be NULL, the normals are only rotated.
+// 'dst_positions' can be 'positions', 'dst_normals' can be 'normals'.
+MATH_INLINE
+void
+skin_dualquatf_array(
+  const dualquatf *bones,
+  const uint32_t *indices,
+  const float *weights,
+  uint32_t influences,
+  const point3f *positions,
+  const vector3f *normals,
+  point3f *dst_positions,
+  vector3f *dst_normals,
+  uint32_t count);
+
+#include "dualquatf_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -16,6 +16,8 @@ extern "C" {
 #endif
 
 #include <math/vector3f.h>
+#include <math/segment.h>
+#include <math/simd.h>
 
 
 typedef
@@ -24,28 +26,65 @@ struct face_t {
 } face_t;
 
 // IMPORTANT: normals are assumed unitary in all these functions.
-inline
+MATH_INLINE
 face_t
 get_extended_face(
   const face_t *face,
   float radius);
 
-inline
+MATH_INLINE
 void
 get_faces_normals(
   const face_t *faces,
   const uint32_t count,
   vector3f *normals);
 
+// a face is degenerate when the squared sine of the angle between its edges is
+// below this, that is well under the rounding noise of the cross product.
+#define FACE_DEGENERATE_SIN_SQUARED 1e-12f
+
+// zero normal if the face is degenerate.
+MATH_INLINE
+void
+get_face_normal_safe(
+  const face_t *face,
+  vector3f *normal);
+
+// same as get_faces_normals() using an approximate reciprocal square root
+// refined by one newton step (relative error ~1e-6). Degenerate faces get a
+// zero normal instead of NaNs.
+MATH_INLINE
+void
+get_faces_normals_fast(
+  const face_t *faces,
+  const uint32_t count,
+  vector3f *normals);
+
+// computes the 'partition'th slice of 'partition_count' of the range using
+// get_faces_normals_fast(), each worker thread is handed its own index and all
+// write to the same 'normals' array. Slice boundaries are kept a multiple of
+// FACES_NORMALS_PARTITION_ALIGNMENT faces (3 cache lines of normals), so with a
+// cache aligned 'normals' no two workers write to the same line.
+#define FACES_NORMALS_PARTITION_ALIGNMENT 16
+
+MATH_INLINE
+void
+get_faces_normals_partition(
+  const face_t *faces,
+  const uint32_t count,
+  vector3f *normals,
+  uint32_t partition,
+  uint32_t partition_count);
+
 // NOTE: distance < 0 if the point is in the face's negative halfspace.
-inline
+MATH_INLINE
 float
 get_point_distance(
   const face_t *face,
   const vector3f *normal,
   const point3f *point);
 
-inline
+MATH_INLINE
 point3f
 get_point_projection(
   const face_t *face,
@@ -53,6 +92,24 @@ get_point_projection(
   const point3f *point,
   float *distance);
 
+// closest point to 'point' on the face (interior, edges or vertices).
+MATH_INLINE
+point3f
+closest_point_on_face(
+  const point3f *point,
+  const face_t *face);
+
+// closest points between a segment and a face, returns the squared distance
+// between them (0 if the segment goes through the face). 'on_segment' and
+// 'on_face' are optional.
+MATH_INLINE
+float
+closest_points_segment_face(
+  const segment_t *segment,
+  const face_t *face,
+  point3f *on_segment,
+  point3f *on_face);
+
 #include "face.impl"
 
 #ifdef __cplusplus
@@ -0,0 +1,103 @@
+/**
+ * @file frustum.h
+ * @author khalilhenoud@gmail.com
+ * @brief view frustum planes extracted from a projection matrix, culling of
+ * sphere and capsule arrays against them.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef FRUSTUM_DEFINITION_H
+#define FRUSTUM_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <math/capsule.h>
+#include <math/matrix4f.h>
+#include <math/plane.h>
+#include <math/sphere.h>
+#include <math/simd.h>
+
+
+typedef
+enum {
+  FRUSTUM_PLANE_LEFT,
+  FRUSTUM_PLANE_RIGHT,
+  FRUSTUM_PLANE_BOTTOM,
+  FRUSTUM_PLANE_TOP,
+  FRUSTUM_PLANE_NEAR,
+  FRUSTUM_PLANE_FAR,
+  FRUSTUM_PLANE_COUNT
+} FRUSTUM_PLANE;
+
+// the clip space depth range of the projection, [-w, w] for opengl style
+// matrices and [0, w] for direct3d/vulkan style ones.
+typedef
+enum {
+  FRUSTUM_DEPTH_NEGATIVE_ONE_TO_ONE,
+  FRUSTUM_DEPTH_ZERO_TO_ONE
+} FRUSTUM_DEPTH;
+
+// the plane normals point inside, a point is in the frustum when its distance
+// to every plane is positive.
+typedef
+struct frustum_t {
+  plane_t planes[FRUSTUM_PLANE_COUNT];
+} frustum_t;
+
+// 'src' maps column vectors to clip space (see mult_m4f_p3f()). A projection
+// matrix gives the planes in view space, a view-projection one in world space.
+MATH_INLINE
+void
+frustum_set_from_matrix4f(
+  frustum_t *dst,
+  const matrix4f *src,
+  FRUSTUM_DEPTH depth);
+
+////////////////////////////////////////////////////////////////////////////////
+// conservative, returns 0 only if the body is fully outside one of the planes.
+MATH_INLINE
+int32_t
+is_sphere_in_frustum(const frustum_t *frustum, const sphere_t *sphere);
+
+MATH_INLINE
+int32_t
+is_capsule_in_frustum(const frustum_t *frustum, const capsule_t *capsule);
+
+////////////////////////////////////////////////////////////////////////////////
+// sets bit i % 32 of 'visible'[i / 32] for every body 'is_xxx_in_frustum'
+// accepts, 'visible' holds (count + 31) / 32 words.
+// 'hints' is optional and holds one FRUSTUM_PLANE per word of 'visible', zero
+// them before the first call. Each remembers the plane that last rejected
+// bodies of its word and starts with it on the next call, keep the arrays in
+// the same order from one frame to the next to benefit from it.
+MATH_INLINE
+void
+cull_spheres_frustum(
+  const frustum_t *frustum,
+  const sphere_t *spheres,
+  uint32_t count,
+  uint32_t *visible,
+  uint8_t *hints);
+
+MATH_INLINE
+void
+cull_capsules_frustum(
+  const frustum_t *frustum,
+  const capsule_t *capsules,
+  uint32_t count,
+  uint32_t *visible,
+  uint8_t *hints);
+
+#include "frustum.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @file hash_grid.h
+ * @author khalilhenoud@gmail.com
+ * @brief uniform grid hashed on the cell coordinates, for spheres and capsules
+ * that move every frame.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HASH_GRID_DEFINITION_H
+#define HASH_GRID_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/sphere.h>
+#include <math/capsule.h>
+
+
+#define HASH_GRID_INVALID_INDEX 0xffffffff
+
+// an object is stored in the one cell holding its center, queries widen their
+// range by the largest radius inserted so far to still find it (a loose grid).
+// 'radius' bounds the object, 'bucket' is HASH_GRID_INVALID_INDEX when it is
+// not in the grid. 'previous' and 'next' link the objects of a bucket.
+typedef
+struct hash_grid_entry_t {
+  point3f center;
+  float radius;
+  int32_t cell[3];
+  uint32_t bucket;
+  uint32_t previous;
+  uint32_t next;
+} hash_grid_entry_t;
+
+// objects are referenced by their id, the index of their entry.
+// NOTE: the grid does not own any memory.
+typedef
+struct hash_grid_t {
+  float cell_size;
+  float inverse_cell_size;
+  float max_radius;             // only grows, hash_grid_init() resets it.
+  uint32_t *buckets;            // first entry of each bucket.
+  uint32_t bucket_mask;         // bucket count - 1.
+  hash_grid_entry_t *entries;
+  uint32_t capacity;
+} hash_grid_t;
+
+// 'bucket_count' must be a power of 2, about the number of objects works well.
+// 'cell_size' should be close to the diameter of the largest object, 'entries'
+// holds 'capacity' objects.
+MATH_INLINE
+void
+hash_grid_init(
+  hash_grid_t *grid,
+  float cell_size,
+  uint32_t *buckets,
+  uint32_t bucket_count,
+  hash_grid_entry_t *entries,
+  uint32_t capacity);
+
+////////////////////////////////////////////////////////////////////////////////
+// 'id' must not be in the grid already.
+MATH_INLINE
+void
+hash_grid_insert(
+  hash_grid_t *grid,
+  uint32_t id,
+  const point3f *center,
+  float radius);
+
+MATH_INLINE
+void
+hash_grid_insert_sphere(hash_grid_t *grid, uint32_t id, const sphere_t *sphere);
+
+// bounded by a sphere, capsule_t is always upright.
+MATH_INLINE
+void
+hash_grid_insert_capsule(
+  hash_grid_t *grid,
+  uint32_t id,
+  const capsule_t *capsule);
+
+// the radius is kept, remove and insert the object again to change it. Only
+// relinks the object when its center changes cell.
+MATH_INLINE
+void
+hash_grid_move(hash_grid_t *grid, uint32_t id, const point3f *center);
+
+MATH_INLINE
+void
+hash_grid_remove(hash_grid_t *grid, uint32_t id);
+
+////////////////////////////////////////////////////////////////////////////////
+// writes the ids of the objects whose bounding sphere overlaps 'sphere' into
+// 'ids', up to 'capacity'. Returns the number of candidates, which can be more
+// than 'capacity'. Each object is reported once.
+MATH_INLINE
+uint32_t
+get_hash_grid_sphere_candidates(
+  const hash_grid_t *grid,
+  const sphere_t *sphere,
+  uint32_t *ids,
+  uint32_t capacity);
+
+// @see get_hash_grid_sphere_candidates().
+MATH_INLINE
+uint32_t
+get_hash_grid_capsule_candidates(
+  const hash_grid_t *grid,
+  const capsule_t *capsule,
+  uint32_t *ids,
+  uint32_t capacity);
+
+#include "hash_grid.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
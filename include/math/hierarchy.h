@@ -0,0 +1,99 @@
+/**
+ * @file hierarchy.h
+ * @author khalilhenoud@gmail.com
+ * @brief flattened transform hierarchy, world matrices are only recomputed for
+ * the subtrees whose local matrices changed.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef HIERARCHY_DEFINITION_H
+#define HIERARCHY_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <math/matrix4f.h>
+#include <math/quatf.h>
+#include <math/vector3f.h>
+
+
+#define HIERARCHY_NO_PARENT 0xffffffff
+
+// nodes are stored parents first, parents[i] < i or HIERARCHY_NO_PARENT, so a
+// single forward sweep sees every parent updated before its children. A
+// breadth first order (see get_hierarchy_breadth_first_order()) also keeps
+// siblings next to each other.
+// worlds[i] = worlds[parents[i]] * locals[i], locals[i] for the roots.
+// NOTE: the hierarchy does not own any memory, every array holds 'count'
+// entries.
+typedef
+struct hierarchy_t {
+  const uint32_t *parents;
+  matrix4f *locals;
+  matrix4f *worlds;
+  uint8_t *dirty;
+  uint32_t count;
+  uint32_t first_dirty;
+} hierarchy_t;
+
+// every node starts dirty, the first hierarchy_update() computes all of them.
+MATH_INLINE
+void
+hierarchy_init(
+  hierarchy_t *hierarchy,
+  const uint32_t *parents,
+  matrix4f *locals,
+  matrix4f *worlds,
+  uint8_t *dirty,
+  uint32_t count);
+
+MATH_INLINE
+void
+hierarchy_set_local(
+  hierarchy_t *hierarchy,
+  uint32_t node,
+  const matrix4f *local);
+
+// the rotation then the translation, 'rotation' need not be unit.
+MATH_INLINE
+void
+hierarchy_set_local_quatf_v3f(
+  hierarchy_t *hierarchy,
+  uint32_t node,
+  const quatf *rotation,
+  const vector3f *translation);
+
+// recomputes the world matrices of the dirty nodes and all their descendants,
+// the sweep starts at the first dirty node. Clean nodes only cost reading their
+// parent index and flags.
+MATH_INLINE
+void
+hierarchy_update(hierarchy_t *hierarchy);
+
+////////////////////////////////////////////////////////////////////////////////
+// 'parents' is any forest, parents[i] can come after i. Writes into 'order'
+// the nodes roots first then level by level, order[i] being the index in
+// 'parents' of the node now at i, and into 'sorted_parents' its parent in the
+// new numbering (ready for hierarchy_init()). 'scratch' holds 2 * count + 1
+// entries.
+MATH_INLINE
+void
+get_hierarchy_breadth_first_order(
+  const uint32_t *parents,
+  uint32_t count,
+  uint32_t *order,
+  uint32_t *sorted_parents,
+  uint32_t *scratch);
+
+#include "hierarchy.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
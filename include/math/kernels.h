@@ -0,0 +1,153 @@
+/**
+ * @file kernels.h
+ * @author khalilhenoud@gmail.com
+ * @brief batch kernels compiled once per instruction set (math_kernels target),
+ * the best set the cpu supports is picked at runtime.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_KERNELS_H
+#define C_KERNELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/capsule_batch.h>
+#include <math/dualquatf_batch.h>
+#include <math/face.h>
+#include <math/frustum.h>
+#include <math/matrix4f.h>
+#include <math/matrix4f_batch.h>
+#include <math/plane_batch.h>
+#include <math/quatf_batch.h>
+#include <math/ray_batch.h>
+#include <math/segment_batch.h>
+#include <math/vector3f_soa.h>
+
+
+typedef
+enum {
+  MATH_KERNELS_SCALAR,
+  MATH_KERNELS_SSE41,
+  MATH_KERNELS_AVX2,
+  MATH_KERNELS_AVX512,
+  MATH_KERNELS_COUNT
+} MATH_KERNELS_ISA;
+
+// each entry is the inline function of the same name built for 'isa', with the
+// same contract. The single element api stays inline in the headers.
+// NOTE: results can differ in the last bits between instruction sets, AVX2 and
+// up contract multiply-adds into fma.
+typedef
+struct math_kernels_t {
+  MATH_KERNELS_ISA isa;
+  const char *name;
+
+  void (*length_v3f_soa)(const vector3f_soa_t *, float *);
+  void (*length_squared_v3f_soa)(const vector3f_soa_t *, float *);
+  void (*dot_product_v3f_soa)(
+    const vector3f_soa_t *, const vector3f_soa_t *, float *);
+  void (*cross_product_v3f_soa)(
+    const vector3f_soa_t *, const vector3f_soa_t *, vector3f_soa_t *);
+  void (*normalize_v3f_soa)(const vector3f_soa_t *, vector3f_soa_t *);
+  void (*normalize_v3f_soa_mp)(const vector3f_soa_t *, vector3f_soa_t *);
+  void (*normalize_v3f_soa_np)(const vector3f_soa_t *, vector3f_soa_t *);
+  void (*negate_v3f_soa)(const vector3f_soa_t *, vector3f_soa_t *);
+  void (*diff_v3f_soa)(
+    const vector3f_soa_t *, const vector3f_soa_t *, vector3f_soa_t *);
+  void (*add_v3f_soa)(
+    const vector3f_soa_t *, const vector3f_soa_t *, vector3f_soa_t *);
+  void (*mult_v3f_soa)(const vector3f_soa_t *, float, vector3f_soa_t *);
+  void (*lerp_v3f_soa)(
+    const vector3f_soa_t *, const vector3f_soa_t *, float, vector3f_soa_t *);
+
+  matrix4f (*mult_m4f)(const matrix4f *, const matrix4f *);
+  void (*mult_m4f_p3f_strided)(
+    const matrix4f *, const float *, size_t, float *, size_t, uint32_t,
+    int32_t);
+  void (*mult_m4f_v3f_strided)(
+    const matrix4f *, const float *, size_t, float *, size_t, uint32_t,
+    int32_t);
+  void (*mult_m4f_p3f_array)(
+    const matrix4f *, const point3f *, point3f *, uint32_t);
+  void (*mult_m4f_v3f_array)(
+    const matrix4f *, const vector3f *, vector3f *, uint32_t);
+
+  void (*slerp_quatf_array)(
+    const quatf *, const quatf *, const float *, quatf *, uint32_t);
+  void (*nlerp_quatf_array)(
+    const quatf *, const quatf *, const float *, quatf *, uint32_t);
+  void (*mult_quatf_v3f_array)(
+    const quatf *, const vector3f *, vector3f *, uint32_t);
+  void (*mult_quatf_v3f_soa)(
+    const quatf *, const vector3f_soa_t *, vector3f_soa_t *);
+  void (*mult_quatf_v3f_pairwise)(
+    const quatf *, const vector3f *, vector3f *, uint32_t);
+  void (*quatf_set_from_rotation_matrix4f_array)(
+    quatf *, const matrix4f *, uint32_t);
+  void (*quatf_set_from_rotation_matrix3f_array)(
+    quatf *, const matrix3f *, uint32_t);
+  void (*quatf_to_matrix4f_array)(const quatf *, matrix4f *, uint32_t);
+  void (*quatf_to_matrix3f_array)(const quatf *, matrix3f *, uint32_t);
+  void (*quatf_to_matrix3x4f_array)(
+    const quatf *, const vector3f *, rigid3f *, uint32_t);
+
+  void (*skin_dualquatf_array)(
+    const dualquatf *, const uint32_t *, const float *, uint32_t,
+    const point3f *, const vector3f *, point3f *, vector3f *, uint32_t);
+
+  void (*closest_point_on_segment_soa)(
+    const segment_form_t *, const vector3f_soa_t *, vector3f_soa_t *);
+  void (*get_point_distance_to_line_soa)(
+    const segment_form_t *, const vector3f_soa_t *, float *);
+  void (*closest_point_on_segment_array)(
+    const segment_form_t *, const point3f *, point3f *, uint32_t);
+  void (*closest_points_on_segments_soa)(
+    const segment_soa_t *, const segment_soa_t *, float *, vector3f_soa_t *,
+    vector3f_soa_t *);
+
+  void (*get_faces_normals_fast)(const face_t *, const uint32_t, vector3f *);
+  void (*get_faces_normals_partition)(
+    const face_t *, const uint32_t, vector3f *, uint32_t, uint32_t);
+
+  void (*get_plane_distance_soa)(
+    const plane_t *, const vector3f_soa_t *, float *);
+  void (*classify_plane_soa)(
+    const plane_t *, const vector3f_soa_t *, float, uint32_t *, uint32_t *);
+  void (*get_face_cache_distance)(
+    const face_cache_t *, const point3f *, float *);
+  void (*classify_face_cache)(
+    const face_cache_t *, const point3f *, float, uint32_t *, uint32_t *);
+
+  void (*cull_spheres_frustum)(
+    const frustum_t *, const sphere_t *, uint32_t, uint32_t *, uint8_t *);
+  void (*cull_capsules_frustum)(
+    const frustum_t *, const capsule_t *, uint32_t, uint32_t *, uint8_t *);
+
+  int32_t (*raycast_faces_soa)(const ray_t *, const face_soa_t *, ray_hit_t *);
+  void (*raycast_face_soa)(
+    const ray_soa_t *, const face_t *, uint32_t, ray_hit_soa_t *);
+
+  void (*get_oriented_capsule_segment_soa)(
+    const oriented_capsule_t *, segment_soa_t *);
+  void (*get_oriented_capsule_aabb_array)(
+    const oriented_capsule_t *, aabb_t *, uint32_t);
+} math_kernels_t;
+
+// the kernels for the best instruction set of this cpu, picked on first use.
+const math_kernels_t *
+get_math_kernels(void);
+
+// NULL if 'isa' is not supported by the cpu or was not built for the target.
+const math_kernels_t *
+get_math_kernels_isa(MATH_KERNELS_ISA isa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -40,7 +40,7 @@ struct {
 } matrix3f;
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 void
 matrix3f_set_identity(matrix3f *dst)
 {
@@ -50,23 +50,26 @@ matrix3f_set_identity(matrix3f *dst)
   dst->data[M3_RC_00] = dst->data[M3_RC_11] = dst->data[M3_RC_22] = 1.f;
 }
 
-inline
+MATH_INLINE
 void
 matrix3f_copy(matrix3f *dst, const matrix3f *src)
 {
   memcpy(dst->data, src->data, sizeof(dst->data));
 }
 
+MATH_INLINE
 matrix3f
 mult_m3f(const matrix3f *, const matrix3f *);
 
+MATH_INLINE
 void
 mult_set_m3f_f(matrix3f *, float);
 
+MATH_INLINE
 void
 add_set_m3f(matrix3f *, const matrix3f *);
 
-inline
+MATH_INLINE
 void
 matrix3f_set_axisangle(matrix3f *dst, const vector3f *axis, float angle)
 {
@@ -97,7 +100,7 @@ matrix3f_set_axisangle(matrix3f *dst, const vector3f *axis, float angle)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 float
 determinant_m3f(const matrix3f *src)
 {
@@ -111,7 +114,7 @@ determinant_m3f(const matrix3f *src)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 matrix3f
 mult_m3f(const matrix3f *lhs, const matrix3f *rhs)
 {
@@ -155,7 +158,7 @@ mult_m3f(const matrix3f *lhs, const matrix3f *rhs)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_m3f(matrix3f *dst, const matrix3f *rhs)
 {
@@ -163,7 +166,7 @@ mult_set_m3f(matrix3f *dst, const matrix3f *rhs)
   matrix3f_copy(dst, &result);
 }
 
-inline
+MATH_INLINE
 matrix3f
 mult_m3f_f(const matrix3f *lhs, float scale)
 {
@@ -174,7 +177,7 @@ mult_m3f_f(const matrix3f *lhs, float scale)
   return copy;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_m3f_f(matrix3f *dst, float scale)
 {
@@ -182,7 +185,7 @@ mult_set_m3f_f(matrix3f *dst, float scale)
     dst->data[i] *= scale;
 }
 
-inline
+MATH_INLINE
 matrix3f
 add_m3f(const matrix3f *lhs, const matrix3f *rhs)
 {
@@ -192,7 +195,7 @@ add_m3f(const matrix3f *lhs, const matrix3f *rhs)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 add_set_m3f(matrix3f *dst, const matrix3f *rhs)
 {
@@ -200,7 +203,7 @@ add_set_m3f(matrix3f *dst, const matrix3f *rhs)
     dst->data[i] += rhs->data[i];
 }
 
-inline
+MATH_INLINE
 vector3f
 mult_m3f_vec3f(const matrix3f *lhs, const vector3f *rhs)
 {
@@ -221,7 +224,7 @@ mult_m3f_vec3f(const matrix3f *lhs, const vector3f *rhs)
 }
 
 // will return rhs address so it can be reused.
-inline
+MATH_INLINE
 vector3f*
 mult_set_m3f_vec3f(const matrix3f *lhs, vector3f *rhs)
 {
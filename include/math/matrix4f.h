@@ -16,6 +16,7 @@ extern "C" {
 #endif
 
 #include <math/matrix3f.h>
+#include <math/simd.h>
 
 
 typedef
@@ -44,7 +45,7 @@ struct matrix4f {
 } matrix4f;
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 void
 matrix4f_set_identity(matrix4f *dst)
 {
@@ -56,14 +57,14 @@ matrix4f_set_identity(matrix4f *dst)
   dst->data[M4_RC_33] = 1.f;
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_copy(matrix4f *dst, const matrix4f *src)
 {
   memcpy(dst->data, src->data, sizeof(dst->data));
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_rotation_x(matrix4f *dst, float angle_radian)
 {
@@ -73,7 +74,7 @@ matrix4f_rotation_x(matrix4f *dst, float angle_radian)
   dst->data[M4_RC_12] = -dst->data[M4_RC_21];
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_rotation_y(matrix4f *dst, float angle_radian)
 {
@@ -83,7 +84,7 @@ matrix4f_rotation_y(matrix4f *dst, float angle_radian)
   dst->data[M4_RC_20] = -dst->data[M4_RC_02];
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_rotation_z(matrix4f *dst, float angle_radian)
 {
@@ -93,7 +94,7 @@ matrix4f_rotation_z(matrix4f *dst, float angle_radian)
   dst->data[M4_RC_01] = -dst->data[M4_RC_10];
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_translation(matrix4f *dst, float x, float y, float z)
 {
@@ -103,7 +104,7 @@ matrix4f_translation(matrix4f *dst, float x, float y, float z)
   dst->data[M4_RC_23] = z;
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_scale(matrix4f *dst, float x, float y, float z)
 {
@@ -113,7 +114,7 @@ matrix4f_scale(matrix4f *dst, float x, float y, float z)
   dst->data[M4_RC_22] = z;
 }
 
-inline
+MATH_INLINE
 void
 matrix4f_set_axisangle(matrix4f *dst, const vector3f *axis, float angle)
 {
@@ -139,7 +140,7 @@ matrix4f_set_axisangle(matrix4f *dst, const vector3f *axis, float angle)
 
 // Calculate the matrix that when multiplied by another vector 'v' will give the
 // equivalent @a vec cross 'v' resultant vector.
-inline
+MATH_INLINE
 void
 matrix4f_cross_product(matrix4f *dst, const vector3f *vec)
 {
@@ -158,7 +159,7 @@ matrix4f_cross_product(matrix4f *dst, const vector3f *vec)
 
 // convert our row major matrix (directx format) to column major (opengl is
 // column major).
-inline
+MATH_INLINE
 void
 matrix4f_set_column_major(matrix4f *dst, const matrix4f *src)
 {
@@ -181,7 +182,7 @@ matrix4f_set_column_major(matrix4f *dst, const matrix4f *src)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 float
 determinant_m4f(const matrix4f *src)
 {
@@ -238,7 +239,7 @@ determinant_m4f(const matrix4f *src)
     src->data[M4_RC_02] * det2 - src->data[M4_RC_03] * det3;
 }
 
-inline
+MATH_INLINE
 matrix4f
 transpose_m4f(const matrix4f *src)
 {
@@ -262,7 +263,7 @@ transpose_m4f(const matrix4f *src)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 transpose_set_m4f(matrix4f *dst)
 {
@@ -270,10 +271,11 @@ transpose_set_m4f(matrix4f *dst)
   matrix4f_copy(dst, &result);
 }
 
+MATH_INLINE
 void
 mult_set_m4f_f(matrix4f *dst, float scale);
 
-inline
+MATH_INLINE
 matrix4f
 inverse_m4f(const matrix4f *src)
 {
@@ -483,7 +485,7 @@ inverse_m4f(const matrix4f *src)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 inverse_set_m4f(matrix4f *dst)
 {
@@ -493,7 +495,7 @@ inverse_set_m4f(matrix4f *dst)
 
 // will extract the axis and the angles in degrees from src. src should be a
 // rotation matrix (otherwise result is undefined).
-inline
+MATH_INLINE
 void
 to_axisangle_m4f(const matrix4f *src, vector3f *axis, float *angle_deg)
 {
@@ -543,11 +545,67 @@ to_axisangle_m4f(const matrix4f *src, vector3f *axis, float *angle_deg)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 matrix4f
 mult_m4f(const matrix4f *lhs, const matrix4f *rhs)
 {
   matrix4f result;
+#if defined(MATH_SIMD_AVX2)
+  // each 256 bit register holds two result rows, the rhs rows are duplicated in
+  // both halves and the lhs elements are splat within each half.
+  {
+    __m256 l, r;
+    __m256 row0 = _mm256_broadcast_ps((const __m128 *)(rhs->data + M4_RC_00));
+    __m256 row1 = _mm256_broadcast_ps((const __m128 *)(rhs->data + M4_RC_10));
+    __m256 row2 = _mm256_broadcast_ps((const __m128 *)(rhs->data + M4_RC_20));
+    __m256 row3 = _mm256_broadcast_ps((const __m128 *)(rhs->data + M4_RC_30));
+    l = _mm256_loadu_ps(lhs->data + M4_RC_00);
+    r = _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0x00), row0);
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0x55), row1));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0xaa), row2));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0xff), row3));
+    _mm256_storeu_ps(result.data + M4_RC_00, r);
+    l = _mm256_loadu_ps(lhs->data + M4_RC_20);
+    r = _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0x00), row0);
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0x55), row1));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0xaa), row2));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_shuffle_ps(l, l, 0xff), row3));
+    _mm256_storeu_ps(result.data + M4_RC_20, r);
+  }
+#elif defined(MATH_SIMD_SSE2)
+  // result row i is the lhs row i elements scaling the rows of rhs.
+  {
+    __m128 l, r;
+    __m128 row0 = _mm_loadu_ps(rhs->data + M4_RC_00);
+    __m128 row1 = _mm_loadu_ps(rhs->data + M4_RC_10);
+    __m128 row2 = _mm_loadu_ps(rhs->data + M4_RC_20);
+    __m128 row3 = _mm_loadu_ps(rhs->data + M4_RC_30);
+    l = _mm_loadu_ps(lhs->data + M4_RC_00);
+    r = _mm_mul_ps(_mm_shuffle_ps(l, l, 0x00), row0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0x55), row1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xaa), row2));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xff), row3));
+    _mm_storeu_ps(result.data + M4_RC_00, r);
+    l = _mm_loadu_ps(lhs->data + M4_RC_10);
+    r = _mm_mul_ps(_mm_shuffle_ps(l, l, 0x00), row0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0x55), row1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xaa), row2));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xff), row3));
+    _mm_storeu_ps(result.data + M4_RC_10, r);
+    l = _mm_loadu_ps(lhs->data + M4_RC_20);
+    r = _mm_mul_ps(_mm_shuffle_ps(l, l, 0x00), row0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0x55), row1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xaa), row2));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xff), row3));
+    _mm_storeu_ps(result.data + M4_RC_20, r);
+    l = _mm_loadu_ps(lhs->data + M4_RC_30);
+    r = _mm_mul_ps(_mm_shuffle_ps(l, l, 0x00), row0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0x55), row1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xaa), row2));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(l, l, 0xff), row3));
+    _mm_storeu_ps(result.data + M4_RC_30, r);
+  }
+#else
   result.data[M4_RC_00] =
     lhs->data[M4_RC_00] * rhs->data[M4_RC_00] +
     lhs->data[M4_RC_01] * rhs->data[M4_RC_10] +
@@ -628,10 +686,11 @@ mult_m4f(const matrix4f *lhs, const matrix4f *rhs)
     lhs->data[M4_RC_31] * rhs->data[M4_RC_13] +
     lhs->data[M4_RC_32] * rhs->data[M4_RC_23] +
     lhs->data[M4_RC_33] * rhs->data[M4_RC_33];
+#endif
   return result;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_m4f(matrix4f *dst, const matrix4f *rhs)
 {
@@ -639,7 +698,7 @@ mult_set_m4f(matrix4f *dst, const matrix4f *rhs)
   matrix4f_copy(dst, &result);
 }
 
-inline
+MATH_INLINE
 matrix4f
 mult_m4f_f(const matrix4f *src, float scale)
 {
@@ -650,7 +709,7 @@ mult_m4f_f(const matrix4f *src, float scale)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_m4f_f(matrix4f *dst, float scale)
 {
@@ -658,7 +717,10 @@ mult_set_m4f_f(matrix4f *dst, float scale)
     dst->data[i] *= scale;
 }
 
-inline
+// NOTE: the single vector/point variants stay scalar on purpose, with a row
+// major layout a lone vector needs a horizontal reduction that measured slower
+// than the 9 multiply-adds the compiler already schedules well.
+MATH_INLINE
 vector3f
 mult_m4f_v3f(const matrix4f *lhs, const vector3f *rhs)
 {
@@ -678,7 +740,7 @@ mult_m4f_v3f(const matrix4f *lhs, const vector3f *rhs)
 }
 
 // will return rhs address so it can be reused.
-inline
+MATH_INLINE
 vector3f*
 mult_set_m4f_v3f(const matrix4f *lhs, vector3f *rhs)
 {
@@ -689,7 +751,7 @@ mult_set_m4f_v3f(const matrix4f *lhs, vector3f *rhs)
 
 // point variant of the vector functionality, takes into account translation
 // transformation
-inline
+MATH_INLINE
 vector3f
 mult_m4f_p3f(const matrix4f *lhs, const vector3f *rhs)
 {
@@ -710,7 +772,7 @@ mult_m4f_p3f(const matrix4f *lhs, const vector3f *rhs)
 
 // point variant of the vector functionality, takes into account translation
 // transformation. Will return rhs address so it can be reused.
-inline
+MATH_INLINE
 vector3f*
 mult_set_m4f_p3f(const matrix4f *lhs, vector3f *rhs)
 {
@@ -0,0 +1,87 @@
+/**
+ * @file matrix4f_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief transform arrays of points/vectors by a single matrix4f.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_MATRIX4F_BATCH_H
+#define C_MATRIX4F_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <math/matrix4f.h>
+
+
+// 'stride' is the distance in bytes between two consecutive elements, this
+// allows transforming the positions of an interleaved vertex buffer in place.
+// 'src' and 'dst' can point to the same buffer.
+// 'non_temporal' bypasses the cache for the stores, only worth it when 'dst'
+// is much larger than the last level cache and is not read back soon.
+MATH_INLINE
+void
+mult_m4f_p3f_strided(
+  const matrix4f *lhs,
+  const float *src,
+  size_t src_stride,
+  float *dst,
+  size_t dst_stride,
+  uint32_t count,
+  int32_t non_temporal);
+
+// @see mult_m4f_p3f_strided(), ignores the translation.
+MATH_INLINE
+void
+mult_m4f_v3f_strided(
+  const matrix4f *lhs,
+  const float *src,
+  size_t src_stride,
+  float *dst,
+  size_t dst_stride,
+  uint32_t count,
+  int32_t non_temporal);
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+void
+mult_m4f_p3f_array(
+  const matrix4f *lhs,
+  const point3f *src,
+  point3f *dst,
+  uint32_t count);
+
+MATH_INLINE
+void
+mult_set_m4f_p3f_array(
+  const matrix4f *lhs,
+  point3f *dst,
+  uint32_t count);
+
+MATH_INLINE
+void
+mult_m4f_v3f_array(
+  const matrix4f *lhs,
+  const vector3f *src,
+  vector3f *dst,
+  uint32_t count);
+
+MATH_INLINE
+void
+mult_set_m4f_v3f_array(
+  const matrix4f *lhs,
+  vector3f *dst,
+  uint32_t count);
+
+#include "matrix4f_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file plane.h
+ * @author khalilhenoud@gmail.com
+ * @brief plane as a unit normal and a distance, the supporting plane of a face
+ * computed once.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef PLANE_DEFINITION_H
+#define PLANE_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <assert.h>
+#include <math/face.h>
+#include <math/vector3f.h>
+
+
+// the points p where dot(normal, p) + d = 0, 'normal' is unit. The signed
+// distance follows get_point_distance(), positive on the side 'normal' points.
+typedef
+struct plane_t {
+  vector3f normal;
+  float d;
+} plane_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// 'normal' must be unit.
+MATH_INLINE
+void
+plane_set_from_normal_p3f(
+  plane_t *dst,
+  const vector3f *normal,
+  const point3f *point)
+{
+  dst->normal = *normal;
+  dst->d = -dot_product_v3f(normal, point);
+}
+
+// same orientation as get_faces_normals(), a degenerate face gets a zero
+// normal so every point is at distance 0.
+MATH_INLINE
+void
+plane_set_from_face(plane_t *dst, const face_t *face)
+{
+  vector3f normal;
+  get_face_normal_safe(face, &normal);
+  plane_set_from_normal_p3f(dst, &normal, face->points + 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// @see get_point_distance().
+MATH_INLINE
+float
+get_plane_distance(const plane_t *plane, const point3f *point)
+{
+  return
+    plane->normal.data[0] * point->data[0] +
+    plane->normal.data[1] * point->data[1] +
+    plane->normal.data[2] * point->data[2] + plane->d;
+}
+
+// @see get_point_projection().
+MATH_INLINE
+point3f
+get_plane_projection(
+  const plane_t *plane,
+  const point3f *point,
+  float *distance)
+{
+  point3f result;
+  assert(distance != NULL);
+  *distance = get_plane_distance(plane, point);
+  vector3f_set_3f(
+    &result,
+    point->data[0] - plane->normal.data[0] * *distance,
+    point->data[1] - plane->normal.data[1] * *distance,
+    point->data[2] - plane->normal.data[2] * *distance);
+  return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file plane_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief signed distances and halfspace classification of many points against
+ * one plane, or of one point against a cache of face planes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_PLANE_BATCH_H
+#define C_PLANE_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <math/face.h>
+#include <math/plane.h>
+#include <math/vector3f_soa.h>
+
+
+// the planes of a face array as a structure of arrays, built once for static
+// geometry. Each distance is then a dot product and an add.
+// NOTE: the cache does not own its memory, see face_cache_set_buffer().
+typedef
+struct face_cache_t {
+  vector3f_soa_t normals;
+  float *d;
+} face_cache_t;
+
+// size in bytes of the buffer required to cache 'count' faces.
+MATH_INLINE
+size_t
+get_face_cache_buffer_size(uint32_t count);
+
+// 'buffer' must be aligned to VECTOR3F_SOA_ALIGNMENT and be at least
+// get_face_cache_buffer_size() bytes.
+MATH_INLINE
+void
+face_cache_set_buffer(face_cache_t *dst, void *buffer, uint32_t count);
+
+// @see plane_set_from_face(), 'faces' holds the cache count.
+MATH_INLINE
+void
+face_cache_set_from_faces(face_cache_t *dst, const face_t *faces);
+
+////////////////////////////////////////////////////////////////////////////////
+// the classification masks have a bit per point (or face), bit i % 32 of word
+// i / 32. 'front' is set beyond +'epsilon', 'back' below -'epsilon', neither
+// is set for the points on the plane. The arrays hold (count + 31) / 32 words.
+MATH_INLINE
+void
+get_plane_distance_soa(
+  const plane_t *plane,
+  const vector3f_soa_t *points,
+  float *distances);
+
+MATH_INLINE
+void
+classify_plane_soa(
+  const plane_t *plane,
+  const vector3f_soa_t *points,
+  float epsilon,
+  uint32_t *front,
+  uint32_t *back);
+
+// distances[i] is the distance of 'point' to the plane of face i.
+MATH_INLINE
+void
+get_face_cache_distance(
+  const face_cache_t *cache,
+  const point3f *point,
+  float *distances);
+
+MATH_INLINE
+void
+classify_face_cache(
+  const face_cache_t *cache,
+  const point3f *point,
+  float epsilon,
+  uint32_t *front,
+  uint32_t *back);
+
+#include "plane_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -36,7 +36,7 @@ struct quatf {
 } quatf;
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 void
 quatf_set_4f(quatf *dst, float s, float x, float y, float z)
 {
@@ -46,28 +46,28 @@ quatf_set_4f(quatf *dst, float s, float x, float y, float z)
   dst->data[QUAT_Z] = z;
 }
 
-inline
+MATH_INLINE
 void
 quatf_copy(quatf *dst, const quatf *src)
 {
   memcpy(dst->data, src->data, sizeof(src->data));
 }
 
-inline
+MATH_INLINE
 void
 quatf_set_identity(quatf *dst)
 {
   quatf_set_4f(dst, 1.f, 0.f, 0.f, 0.f);
 }
 
-inline
+MATH_INLINE
 void
 quatf_set_a4f(quatf *dst, const float *data)
 {
   quatf_set_4f(dst, data[0], data[1], data[2], data[3]);
 }
 
-inline
+MATH_INLINE
 void
 quatf_set_from_axis_angle(quatf *dst, const vector3f *axis, float angle_radian)
 {
@@ -83,7 +83,7 @@ quatf_set_from_axis_angle(quatf *dst, const vector3f *axis, float angle_radian)
 // below is a very useful resource, it also contains an explanation as to why we
 // test (trace > 0) as opposed to (trace + 1 > 0).
 // https://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
-inline
+MATH_INLINE
 void
 quatf_set_from_rotation_matrix3f(quatf *dst, const matrix3f *from)
 {
@@ -145,7 +145,7 @@ quatf_set_from_rotation_matrix3f(quatf *dst, const matrix3f *from)
 }
 
 // @see quatf_set_from_rotation_matrix3f().
-inline
+MATH_INLINE
 void
 quatf_set_from_rotation_matrix4f(quatf *dst, const matrix4f *from)
 {
@@ -207,10 +207,11 @@ quatf_set_from_rotation_matrix4f(quatf *dst, const matrix4f *from)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
 void
 quatf_set_normalize(quatf *src);
 
-inline
+MATH_INLINE
 void
 get_quatf_axis_angle(quatf quat, vector3f *axis, float *angle)
 {
@@ -232,7 +233,7 @@ get_quatf_axis_angle(quatf quat, vector3f *axis, float *angle)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 float
 length_quatf(const quatf *src)
 {
@@ -243,10 +244,11 @@ length_quatf(const quatf *src)
     src->data[QUAT_Z] * src->data[QUAT_Z]);
 }
 
+MATH_INLINE
 void
 mult_set_quatf_f(quatf *dst, float scale);
 
-inline
+MATH_INLINE
 void
 quatf_set_normalize(quatf *src)
 {
@@ -255,7 +257,7 @@ quatf_set_normalize(quatf *src)
     mult_set_quatf_f(src, 1.f/length);
 }
 
-inline
+MATH_INLINE
 float
 length_squared_quatf(const quatf *src)
 {
@@ -266,7 +268,29 @@ length_squared_quatf(const quatf *src)
     src->data[QUAT_Z] * src->data[QUAT_Z];
 }
 
-inline
+// precision tiers of quatf_set_normalize() without divisions, see rsqrtf_mp()
+// and rsqrtf_np(). The same near zero quaternions are left untouched.
+MATH_INLINE
+void
+quatf_set_normalize_mp(quatf *src)
+{
+  float length_squared = length_squared_quatf(src);
+  float epsilon = EPSILON_FLOAT_LOW_PRECISION;
+  if (length_squared > epsilon * epsilon)
+    mult_set_quatf_f(src, rsqrtf_mp(length_squared));
+}
+
+MATH_INLINE
+void
+quatf_set_normalize_np(quatf *src)
+{
+  float length_squared = length_squared_quatf(src);
+  float epsilon = EPSILON_FLOAT_LOW_PRECISION;
+  if (length_squared > epsilon * epsilon)
+    mult_set_quatf_f(src, rsqrtf_np(length_squared));
+}
+
+MATH_INLINE
 float
 dot_product_quatf(const quatf *lhs, const quatf *rhs)
 {
@@ -277,7 +301,7 @@ dot_product_quatf(const quatf *lhs, const quatf *rhs)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 quatf
 mult_quatf_f(const quatf *src, float scale)
 {
@@ -289,7 +313,7 @@ mult_quatf_f(const quatf *src, float scale)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_quatf_f(quatf *dst, float scale)
 {
@@ -299,7 +323,7 @@ mult_set_quatf_f(quatf *dst, float scale)
   dst->data[QUAT_Z] *= scale;
 }
 
-inline
+MATH_INLINE
 quatf
 add_quatf(const quatf *lhs, const quatf *rhs)
 {
@@ -310,7 +334,7 @@ add_quatf(const quatf *lhs, const quatf *rhs)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 add_set_quatf(quatf *dst, const quatf *rhs)
 {
@@ -318,7 +342,7 @@ add_set_quatf(quatf *dst, const quatf *rhs)
     dst->data[i] += rhs->data[i];
 }
 
-inline
+MATH_INLINE
 quatf
 mult_quatf(const quatf *lhs, const quatf *rhs)
 {
@@ -343,7 +367,7 @@ mult_quatf(const quatf *lhs, const quatf *rhs)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_quatf(quatf *dst, const quatf *rhs)
 {
@@ -351,27 +375,43 @@ mult_set_quatf(quatf *dst, const quatf *rhs)
   *dst = result;
 }
 
-quatf
-inverse_quatf(const quatf *src);
-
-inline
+// 'quat' need not be unit, @see mult_quatf_v3f_unit().
+MATH_INLINE
 vector3f
 mult_quatf_v3f(const quatf *quat, const vector3f *vec)
 {
-  quatf r, q, qinv, result;
-  vector3f resultv;
-  quatf_set_4f(&r, 0.f, vec->data[0], vec->data[1], vec->data[2]);
-  q = *quat;
-  qinv = inverse_quatf(&q);
-  result = mult_quatf(&q, &r);
-  result = mult_quatf(&result, &qinv);
-  vector3f_set_3f(
-    &resultv, result.data[QUAT_X], result.data[QUAT_Y], result.data[QUAT_Z]);
-  return resultv;
+  // q * v * q^-1 expanded, v + 2 * (s * (u x v) + u x (u x v)) / |q|^2 with
+  // 'u' the vector part.
+  vector3f u, uv, uuv, result;
+  float scale = 2.f / length_squared_quatf(quat);
+  vector3f_set_a3f(&u, quat->data + QUAT_X);
+  uv = cross_product_v3f(&u, vec);
+  uuv = cross_product_v3f(&u, &uv);
+  mult_set_v3f(&uv, quat->data[QUAT_S]);
+  add_set_v3f(&uv, &uuv);
+  mult_set_v3f(&uv, scale);
+  result = add_v3f(vec, &uv);
+  return result;
+}
+
+// mult_quatf_v3f() without the division, 'quat' must be unit.
+MATH_INLINE
+vector3f
+mult_quatf_v3f_unit(const quatf *quat, const vector3f *vec)
+{
+  vector3f u, t, ut, result;
+  vector3f_set_a3f(&u, quat->data + QUAT_X);
+  t = cross_product_v3f(&u, vec);
+  mult_set_v3f(&t, 2.f);
+  ut = cross_product_v3f(&u, &t);
+  mult_set_v3f(&t, quat->data[QUAT_S]);
+  add_set_v3f(&t, &ut);
+  result = add_v3f(vec, &t);
+  return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 quatf
 inverse_quatf(const quatf *src)
 {
@@ -384,7 +424,7 @@ inverse_quatf(const quatf *src)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 inverse_set_quatf(quatf *dst)
 {
@@ -393,7 +433,7 @@ inverse_set_quatf(quatf *dst)
 
 // NOTE: this would act as the inverse if src is a unitary quaternion. A
 // quaternion that represents only rotations is guaranteed to be unitary.
-inline
+MATH_INLINE
 quatf
 conjugate_quatf(const quatf *src)
 {
@@ -405,14 +445,14 @@ conjugate_quatf(const quatf *src)
   return result;
 }
 
-inline
+MATH_INLINE
 void
 conjugate_set_quatf(quatf *dst)
 {
   *dst = conjugate_quatf(dst);
 }
 
-inline
+MATH_INLINE
 quatf
 lerp_quatf(quatf src, quatf dst, float lerp_factor)
 {
@@ -424,7 +464,7 @@ lerp_quatf(quatf src, quatf dst, float lerp_factor)
   return calc;
 }
 
-inline
+MATH_INLINE
 quatf
 slerp_quatf(quatf src, quatf dst, float lerp_factor)
 {
@@ -465,7 +505,7 @@ slerp_quatf(quatf src, quatf dst, float lerp_factor)
   return calc;
 }
 
-inline
+MATH_INLINE
 matrix4f
 quatf_to_matrix4f(quatf src)
 {
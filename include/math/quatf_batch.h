@@ -0,0 +1,158 @@
+/**
+ * @file quatf_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief interpolate arrays of quatf pairs, branch free and without trig.
+ * Rotate arrays of vectors, convert arrays between quatf and rotation matrices.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_QUATF_BATCH_H
+#define C_QUATF_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/matrix3f.h>
+#include <math/matrix4f_batch.h>
+#include <math/quatf.h>
+#include <math/simd.h>
+#include <math/transform.h>
+#include <math/vector3f_soa.h>
+
+
+// the slerp weights sin(t * theta) / sin(theta) are evaluated as a polynomial
+// in t and cos(theta) (D. Eberly, "A Fast and Accurate Algorithm for Computing
+// SLERP"), QUATF_SLERP_FAST_TERMS terms with the last one scaled by
+// QUATF_SLERP_FAST_CORRECTION to spread the truncation error.
+// NOTE: for unit inputs and t in [0, 1] each weight is within 2e-5 of the
+// exact one, the worst case being rotations half a turn apart. Every
+// result component is within QUATF_SLERP_FAST_MAX_ERROR (absolute) of the
+// exact slerp.
+#define QUATF_SLERP_FAST_TERMS 8
+#define QUATF_SLERP_FAST_CORRECTION 1.85298109240830f
+#define QUATF_SLERP_FAST_MAX_ERROR 4e-5f
+
+// slerp_quatf() for unit quaternions without acos/sin, takes the shorter arc.
+// Unlike slerp_quatf() the inputs are not normalized.
+MATH_INLINE
+quatf
+slerp_quatf_fast(quatf src, quatf dst, float lerp_factor);
+
+// lerp through the shorter arc then normalize, follows the same path as slerp
+// but not at a constant angular velocity. Normalized within
+// EPSILON_FLOAT_MED_PRECISION.
+MATH_INLINE
+quatf
+nlerp_quatf(quatf src, quatf dst, float lerp_factor);
+
+////////////////////////////////////////////////////////////////////////////////
+// result[i] = slerp_quatf_fast(src[i], dst[i], factors[i]), 'result' can be
+// 'src' or 'dst'.
+MATH_INLINE
+void
+slerp_quatf_array(
+  const quatf *src,
+  const quatf *dst,
+  const float *factors,
+  quatf *result,
+  uint32_t count);
+
+// result[i] = nlerp_quatf(src[i], dst[i], factors[i]), 'result' can be 'src'
+// or 'dst'.
+MATH_INLINE
+void
+nlerp_quatf_array(
+  const quatf *src,
+  const quatf *dst,
+  const float *factors,
+  quatf *result,
+  uint32_t count);
+
+////////////////////////////////////////////////////////////////////////////////
+// dst[i] = mult_quatf_v3f(quat, src[i]) through the rotation matrix of 'quat',
+// cheaper than the quaternion form once it is shared. 'dst' can be 'src'.
+MATH_INLINE
+void
+mult_quatf_v3f_array(
+  const quatf *quat,
+  const vector3f *src,
+  vector3f *dst,
+  uint32_t count);
+
+// @see mult_quatf_v3f_array(), 'dst' can be 'src'.
+MATH_INLINE
+void
+mult_quatf_v3f_soa(
+  const quatf *quat,
+  const vector3f_soa_t *src,
+  vector3f_soa_t *dst);
+
+// dst[i] = mult_quatf_v3f_unit(quats[i], src[i]), the quaternions must be
+// unit. 'dst' can be 'src'.
+MATH_INLINE
+void
+mult_quatf_v3f_pairwise(
+  const quatf *quats,
+  const vector3f *src,
+  vector3f *dst,
+  uint32_t count);
+
+////////////////////////////////////////////////////////////////////////////////
+// the per element conversions branch on the largest diagonal term, the batches
+// evaluate every case and keep the one the scalar version would have taken, so
+// the results agree to rounding (and share their sign).
+
+// dst[i] = quatf_set_from_rotation_matrix4f(src[i]), within 1e-6.
+MATH_INLINE
+void
+quatf_set_from_rotation_matrix4f_array(
+  quatf *dst,
+  const matrix4f *src,
+  uint32_t count);
+
+// dst[i] = quatf_set_from_rotation_matrix3f(src[i]), within 1e-6.
+MATH_INLINE
+void
+quatf_set_from_rotation_matrix3f_array(
+  quatf *dst,
+  const matrix3f *src,
+  uint32_t count);
+
+// dst[i] = quatf_to_matrix4f(src[i]), the quaternions need not be unit.
+MATH_INLINE
+void
+quatf_to_matrix4f_array(
+  const quatf *src,
+  matrix4f *dst,
+  uint32_t count);
+
+// the 3x3 rotation part of quatf_to_matrix4f_array().
+MATH_INLINE
+void
+quatf_to_matrix3f_array(
+  const quatf *src,
+  matrix3f *dst,
+  uint32_t count);
+
+// the first 3 rows of quatf_to_matrix4f_array() as rigid transforms, with
+// translations[i] as the translation (0 if 'translations' is NULL). The
+// constant last row is never written.
+MATH_INLINE
+void
+quatf_to_matrix3x4f_array(
+  const quatf *src,
+  const vector3f *translations,
+  rigid3f *dst,
+  uint32_t count);
+
+#include "quatf_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
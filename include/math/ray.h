@@ -0,0 +1,131 @@
+/**
+ * @file ray.h
+ * @author khalilhenoud@gmail.com
+ * @brief ray against face intersection (Moller/Trumbore, "Fast, Minimum
+ * Storage Ray/Triangle Intersection").
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef RAY_DEFINITION_H
+#define RAY_DEFINITION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <assert.h>
+#include <stdint.h>
+#include <math/face.h>
+#include <math/vector3f.h>
+
+
+// hits sitting on an edge within this barycentric distance are accepted, so a
+// ray through the edge shared by two faces does not slip between them.
+#define RAY_BARYCENTRIC_EPSILON 1e-6f
+
+// the points 'origin' + t * 'direction' with t > 0, 'direction' need not be
+// unit in which case the hit distances are in units of its length.
+typedef
+struct ray_t {
+  point3f origin;
+  vector3f direction;
+} ray_t;
+
+// the hit point is points[0] + u * (points[1] - points[0]) + v * (points[2] -
+// points[0]) of face 'face'.
+typedef
+struct ray_hit_t {
+  float distance;
+  float u;
+  float v;
+  uint32_t face;
+} ray_hit_t;
+
+// the face as 'origin' + u * 'edge1' + v * 'edge2'. Faces are double sided,
+// degenerate faces and faces parallel to the ray are never hit. Returns 1 and
+// fills 'hit' if the face is hit closer than 'hit'->distance, 'hit'->face is
+// left to the caller.
+MATH_INLINE
+int32_t
+raycast_face_edges(
+  const ray_t *ray,
+  const point3f *origin,
+  const vector3f *edge1,
+  const vector3f *edge2,
+  ray_hit_t *hit)
+{
+  vector3f p, q, s;
+  float inverse, u, v, distance;
+
+  p = cross_product_v3f(&ray->direction, edge2);
+  inverse = 1.f / dot_product_v3f(edge1, &p);
+  s = diff_v3f(origin, &ray->origin);
+  u = dot_product_v3f(&s, &p) * inverse;
+  q = cross_product_v3f(&s, edge1);
+  v = dot_product_v3f(&ray->direction, &q) * inverse;
+  distance = dot_product_v3f(edge2, &q) * inverse;
+
+  // written so that NaNs (parallel or degenerate) fail every test.
+  if (
+    u > -RAY_BARYCENTRIC_EPSILON &&
+    v > -RAY_BARYCENTRIC_EPSILON &&
+    1.f + RAY_BARYCENTRIC_EPSILON > u + v &&
+    distance > 0.f &&
+    hit->distance > distance) {
+    hit->distance = distance;
+    hit->u = u;
+    hit->v = v;
+    return 1;
+  }
+
+  return 0;
+}
+
+// 'hit'->distance must be set to the farthest distance of interest (FLT_MAX
+// for all), 'hit' is only updated with a closer hit which then gets 'index' as
+// its face.
+MATH_INLINE
+int32_t
+raycast_face(
+  const ray_t *ray,
+  const face_t *face,
+  uint32_t index,
+  ray_hit_t *hit)
+{
+  vector3f edge1, edge2;
+  assert(ray != NULL && face != NULL && hit != NULL);
+
+  edge1 = diff_v3f(face->points + 0, face->points + 1);
+  edge2 = diff_v3f(face->points + 0, face->points + 2);
+  if (!raycast_face_edges(ray, face->points + 0, &edge1, &edge2, hit))
+    return 0;
+
+  hit->face = index;
+  return 1;
+}
+
+// the closest of 'faces' hit, @see raycast_face().
+MATH_INLINE
+int32_t
+raycast_faces(
+  const ray_t *ray,
+  const face_t *faces,
+  uint32_t count,
+  ray_hit_t *hit)
+{
+  int32_t found = 0;
+  assert(faces != NULL || count == 0);
+
+  for (uint32_t i = 0; i < count; ++i)
+    found |= raycast_face(ray, faces + i, i, hit);
+  return found;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file ray_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief one ray against many faces and many rays against one face.
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_RAY_BATCH_H
+#define C_RAY_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <math/face.h>
+#include <math/ray.h>
+#include <math/vector3f_soa.h>
+
+
+// faces prepared for ray casts, face i is origins[i] + u * edges[0][i] + v *
+// edges[1][i], see raycast_face_edges(). All streams hold the same count.
+typedef
+struct face_soa_t {
+  vector3f_soa_t origins;
+  vector3f_soa_t edges[2];
+} face_soa_t;
+
+// ray_t as a structure of arrays, both streams hold the same count.
+typedef
+struct ray_soa_t {
+  vector3f_soa_t origins;
+  vector3f_soa_t directions;
+} ray_soa_t;
+
+// ray_hit_t as a structure of arrays, each holds one entry per ray.
+typedef
+struct ray_hit_soa_t {
+  float *distances;
+  float *u;
+  float *v;
+  uint32_t *faces;
+} ray_hit_soa_t;
+
+MATH_INLINE
+size_t
+get_face_soa_buffer_size(uint32_t count);
+
+// 'buffer' follows the requirements of vector3f_soa_set_buffer() and must be
+// at least get_face_soa_buffer_size() bytes.
+MATH_INLINE
+void
+face_soa_set_buffer(face_soa_t *dst, void *buffer, uint32_t count);
+
+MATH_INLINE
+void
+face_soa_set_from_faces(face_soa_t *dst, const face_t *faces);
+
+////////////////////////////////////////////////////////////////////////////////
+// the closest of 'faces' hit by 'ray', same contract as raycast_faces().
+MATH_INLINE
+int32_t
+raycast_faces_soa(
+  const ray_t *ray,
+  const face_soa_t *faces,
+  ray_hit_t *hit);
+
+// raycast_face() for every ray of 'rays', 'hits' is updated where 'face' is
+// closer than hits->distances[i]. Calling it once per face gives the closest
+// hit of each ray.
+MATH_INLINE
+void
+raycast_face_soa(
+  const ray_soa_t *rays,
+  const face_t *face,
+  uint32_t index,
+  ray_hit_soa_t *hits);
+
+#include "ray_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -25,25 +25,67 @@ struct segment_t {
 
 typedef segment_t line_t;
 
-inline
+// a segment prepared for many queries, its points are 'origin' + t *
+// 'direction' with t in [0, 1]. 'inverse_length_squared' is 0 for a collapsed
+// segment, which then behaves as the point 'origin'.
+typedef
+struct segment_form_t {
+  point3f origin;
+  vector3f direction;
+  float inverse_length_squared;
+} segment_form_t;
+
+MATH_INLINE
 point3f
 closest_point_on_segment(
   const point3f *point,
   const segment_t *target);
 
-inline
+MATH_INLINE
 point3f
 closest_point_on_segment_loose(
   const point3f *point,
   const point3f *a,
   const point3f *b);
 
-inline
+MATH_INLINE
 float
 get_point_distance_to_line(
   const point3f *point,
   const line_t *target);
 
+// closest points between two segments, returns the squared distance between
+// them. Handles parallel and collapsed segments. 'on_lhs'/'on_rhs' are
+// optional.
+MATH_INLINE
+float
+closest_points_on_segments(
+  const segment_t *lhs,
+  const segment_t *rhs,
+  point3f *on_lhs,
+  point3f *on_rhs);
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+void
+segment_form_set_from_segment(
+  segment_form_t *dst,
+  const segment_t *src);
+
+// @see closest_point_on_segment(), without the per call setup.
+MATH_INLINE
+point3f
+closest_point_on_segment_form(
+  const point3f *point,
+  const segment_form_t *target);
+
+// @see get_point_distance_to_line(), without the per call setup.
+MATH_INLINE
+float
+get_point_distance_to_line_form(
+  const point3f *point,
+  const segment_form_t *target);
+
 #include "segment.impl"
 
 #ifdef __cplusplus
@@ -0,0 +1,74 @@
+/**
+ * @file segment_batch.h
+ * @author khalilhenoud@gmail.com
+ * @brief project arrays of points onto a single segment/line.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_SEGMENT_BATCH_H
+#define C_SEGMENT_BATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/segment.h>
+#include <math/vector3f_soa.h>
+
+
+// segment_t as a structure of arrays, both streams hold the same count.
+typedef
+struct segment_soa_t {
+  vector3f_soa_t points[2];
+} segment_soa_t;
+
+// @see closest_point_on_segment_form(), 'dst' may alias 'points'.
+MATH_INLINE
+void
+closest_point_on_segment_soa(
+  const segment_form_t *target,
+  const vector3f_soa_t *points,
+  vector3f_soa_t *dst);
+
+// @see get_point_distance_to_line_form().
+MATH_INLINE
+void
+get_point_distance_to_line_soa(
+  const segment_form_t *target,
+  const vector3f_soa_t *points,
+  float *distances);
+
+// @see closest_point_on_segment_soa(), 'dst' may alias 'points'.
+MATH_INLINE
+void
+closest_point_on_segment_array(
+  const segment_form_t *target,
+  const point3f *points,
+  point3f *dst,
+  uint32_t count);
+
+////////////////////////////////////////////////////////////////////////////////
+// closest_points_on_segments() between lhs[i] and rhs[i], without branches so
+// parallel and collapsed segments cost the same. 'on_lhs' and 'on_rhs' are
+// optional, all the arrays hold the same count.
+// NOTE: when the closest points are not unique (parallel segments) the pair
+// returned can differ from the scalar one, the distance is the same.
+MATH_INLINE
+void
+closest_points_on_segments_soa(
+  const segment_soa_t *lhs,
+  const segment_soa_t *rhs,
+  float *distances_squared,
+  vector3f_soa_t *on_lhs,
+  vector3f_soa_t *on_rhs);
+
+#include "segment_batch.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
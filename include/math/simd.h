@@ -0,0 +1,615 @@
+/**
+ * @file simd.h
+ * @author khalilhenoud@gmail.com
+ * @brief thin lane abstraction used by the batch kernels, the width is picked
+ * at compile time from the target instruction set.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_SIMD_H
+#define C_SIMD_H
+
+// NOTE: define MATH_SIMD_DISABLE to force the scalar reference path.
+// MATH_SIMD_AVX512 also defines MATH_SIMD_AVX2, code written for 128/256 bit
+// registers keeps using its AVX2 path.
+#if !defined(MATH_SIMD_DISABLE) && defined(__AVX512F__)
+#define MATH_SIMD_AVX512
+#define MATH_SIMD_AVX2
+#elif !defined(MATH_SIMD_DISABLE) && defined(__AVX2__)
+#define MATH_SIMD_AVX2
+#elif \
+  !defined(MATH_SIMD_DISABLE) && \
+  (defined(__SSE2__) || defined(_M_X64) || \
+  (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SIMD_SSE2
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(MATH_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <math/common.h>
+
+
+#if defined(MATH_SIMD_AVX512)
+#define SIMD_WIDTH 16
+typedef __m512 simdf;
+#elif defined(MATH_SIMD_AVX2)
+#define SIMD_WIDTH 8
+typedef __m256 simdf;
+#elif defined(MATH_SIMD_SSE2)
+#define SIMD_WIDTH 4
+typedef __m128 simdf;
+#else
+#define SIMD_WIDTH 1
+typedef float simdf;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+simdf
+simdf_set_1f(float value)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_set1_ps(value);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_set1_ps(value);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_set1_ps(value);
+#else
+  return value;
+#endif
+}
+
+// NOTE: loads and stores are unaligned, SoA streams are aligned anyway so this
+// costs nothing on them and keeps the kernels usable on arbitrary arrays.
+MATH_INLINE
+simdf
+simdf_load(const float *src)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_loadu_ps(src);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_loadu_ps(src);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_loadu_ps(src);
+#else
+  return *src;
+#endif
+}
+
+MATH_INLINE
+void
+simdf_store(float *dst, simdf value)
+{
+#if defined(MATH_SIMD_AVX512)
+  _mm512_storeu_ps(dst, value);
+#elif defined(MATH_SIMD_AVX2)
+  _mm256_storeu_ps(dst, value);
+#elif defined(MATH_SIMD_SSE2)
+  _mm_storeu_ps(dst, value);
+#else
+  *dst = value;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+simdf
+add_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_add_ps(lhs, rhs);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_add_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_add_ps(lhs, rhs);
+#else
+  return lhs + rhs;
+#endif
+}
+
+// returns lhs - rhs.
+MATH_INLINE
+simdf
+sub_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_sub_ps(lhs, rhs);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_sub_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_sub_ps(lhs, rhs);
+#else
+  return lhs - rhs;
+#endif
+}
+
+MATH_INLINE
+simdf
+mult_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_mul_ps(lhs, rhs);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_mul_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_mul_ps(lhs, rhs);
+#else
+  return lhs * rhs;
+#endif
+}
+
+MATH_INLINE
+simdf
+div_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_div_ps(lhs, rhs);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_div_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_div_ps(lhs, rhs);
+#else
+  return lhs / rhs;
+#endif
+}
+
+// returns lhs * rhs + add, fused when the target supports it.
+MATH_INLINE
+simdf
+madd_simdf(simdf lhs, simdf rhs, simdf add)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_fmadd_ps(lhs, rhs, add);
+#elif defined(MATH_SIMD_AVX2) && defined(__FMA__)
+  return _mm256_fmadd_ps(lhs, rhs, add);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_add_ps(_mm256_mul_ps(lhs, rhs), add);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_add_ps(_mm_mul_ps(lhs, rhs), add);
+#else
+  return lhs * rhs + add;
+#endif
+}
+
+MATH_INLINE
+simdf
+sqrt_simdf(simdf src)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_sqrt_ps(src);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_sqrt_ps(src);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_sqrt_ps(src);
+#else
+  return sqrtf(src);
+#endif
+}
+
+// returns 'rhs' when either is NaN, like the min/max instructions.
+MATH_INLINE
+simdf
+min_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_min_ps(lhs, rhs);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_min_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_min_ps(lhs, rhs);
+#else
+  return lhs < rhs ? lhs : rhs;
+#endif
+}
+
+MATH_INLINE
+simdf
+max_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_max_ps(lhs, rhs);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_max_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_max_ps(lhs, rhs);
+#else
+  return lhs > rhs ? lhs : rhs;
+#endif
+}
+
+// all bits set in the lanes where 'lhs' > 'rhs', 0 elsewhere. A mask for
+// and_simdf(), which then zeroes the lanes failing the test.
+MATH_INLINE
+simdf
+greater_than_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_castsi512_ps(
+    _mm512_maskz_set1_epi32(_mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OQ), -1));
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_cmpgt_ps(lhs, rhs);
+#else
+  union { float f; uint32_t u; } mask;
+  mask.u = lhs > rhs ? 0xffffffff : 0;
+  return mask.f;
+#endif
+}
+
+// the sign bit of each lane packed into the low SIMD_WIDTH bits, lane 0 first.
+MATH_INLINE
+uint32_t
+movemask_simdf(simdf src)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_cmplt_epi32_mask(
+    _mm512_castps_si512(src), _mm512_setzero_si512());
+#elif defined(MATH_SIMD_AVX2)
+  return (uint32_t)_mm256_movemask_ps(src);
+#elif defined(MATH_SIMD_SSE2)
+  return (uint32_t)_mm_movemask_ps(src);
+#else
+  union { float f; uint32_t u; } bits;
+  bits.f = src;
+  return bits.u >> 31;
+#endif
+}
+
+// bitwise, used to move sign bits around without branching.
+MATH_INLINE
+simdf
+and_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_castsi512_ps(
+    _mm512_and_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_and_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_and_ps(lhs, rhs);
+#else
+  union { float f; uint32_t u; } l, r;
+  l.f = lhs;
+  r.f = rhs;
+  l.u &= r.u;
+  return l.f;
+#endif
+}
+
+MATH_INLINE
+simdf
+xor_simdf(simdf lhs, simdf rhs)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_castsi512_ps(
+    _mm512_xor_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_xor_ps(lhs, rhs);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_xor_ps(lhs, rhs);
+#else
+  union { float f; uint32_t u; } l, r;
+  l.f = lhs;
+  r.f = rhs;
+  l.u ^= r.u;
+  return l.f;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// transposes the 4x4 blocks held in each 128 bit lane of a, b, c and d.
+MATH_INLINE
+void
+simdf_transpose_4x(simdf *a, simdf *b, simdf *c, simdf *d)
+{
+#if defined(MATH_SIMD_AVX512)
+  __m512 t0 = _mm512_unpacklo_ps(*a, *b), t1 = _mm512_unpacklo_ps(*c, *d);
+  __m512 t2 = _mm512_unpackhi_ps(*a, *b), t3 = _mm512_unpackhi_ps(*c, *d);
+  *a = _mm512_shuffle_ps(t0, t1, 0x44);
+  *b = _mm512_shuffle_ps(t0, t1, 0xee);
+  *c = _mm512_shuffle_ps(t2, t3, 0x44);
+  *d = _mm512_shuffle_ps(t2, t3, 0xee);
+#elif defined(MATH_SIMD_AVX2)
+  __m256 t0 = _mm256_unpacklo_ps(*a, *b), t1 = _mm256_unpacklo_ps(*c, *d);
+  __m256 t2 = _mm256_unpackhi_ps(*a, *b), t3 = _mm256_unpackhi_ps(*c, *d);
+  *a = _mm256_shuffle_ps(t0, t1, 0x44);
+  *b = _mm256_shuffle_ps(t0, t1, 0xee);
+  *c = _mm256_shuffle_ps(t2, t3, 0x44);
+  *d = _mm256_shuffle_ps(t2, t3, 0xee);
+#elif defined(MATH_SIMD_SSE2)
+  _MM_TRANSPOSE4_PS(*a, *b, *c, *d);
+#else
+  (void)a, (void)b, (void)c, (void)d;
+#endif
+}
+
+#if SIMD_WIDTH > 1
+// 128 bit lane k is loaded from the 4 floats at 'src' + k * 'step'.
+MATH_INLINE
+simdf
+simdf_load_lanes(const float *src, size_t step)
+{
+#if defined(MATH_SIMD_AVX512)
+  __m512 result = _mm512_castps128_ps512(_mm_loadu_ps(src));
+  result = _mm512_insertf32x4(result, _mm_loadu_ps(src + step), 1);
+  result = _mm512_insertf32x4(result, _mm_loadu_ps(src + step * 2), 2);
+  return _mm512_insertf32x4(result, _mm_loadu_ps(src + step * 3), 3);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_insertf128_ps(
+    _mm256_castps128_ps256(_mm_loadu_ps(src)), _mm_loadu_ps(src + step), 1);
+#else
+  (void)step;
+  return _mm_loadu_ps(src);
+#endif
+}
+
+// the inverse of simdf_load_lanes().
+MATH_INLINE
+void
+simdf_store_lanes(float *dst, size_t step, simdf value)
+{
+#if defined(MATH_SIMD_AVX512)
+  _mm_storeu_ps(dst, _mm512_castps512_ps128(value));
+  _mm_storeu_ps(dst + step, _mm512_extractf32x4_ps(value, 1));
+  _mm_storeu_ps(dst + step * 2, _mm512_extractf32x4_ps(value, 2));
+  _mm_storeu_ps(dst + step * 3, _mm512_extractf32x4_ps(value, 3));
+#elif defined(MATH_SIMD_AVX2)
+  _mm_storeu_ps(dst, _mm256_castps256_ps128(value));
+  _mm_storeu_ps(dst + step, _mm256_extractf128_ps(value, 1));
+#else
+  (void)step;
+  _mm_storeu_ps(dst, value);
+#endif
+}
+#endif
+
+// loads the first 4 floats of SIMD_WIDTH structures 'stride' floats apart
+// (rows of matrix4f...) from 'src' and splits them into a, b, c and d.
+MATH_INLINE
+void
+simdf_load_4x_strided(
+  const float *src,
+  size_t stride,
+  simdf *a,
+  simdf *b,
+  simdf *c,
+  simdf *d)
+{
+#if SIMD_WIDTH == 1
+  (void)stride;
+  *a = src[0];
+  *b = src[1];
+  *c = src[2];
+  *d = src[3];
+#else
+  *a = simdf_load_lanes(src + stride * 0, stride * 4);
+  *b = simdf_load_lanes(src + stride * 1, stride * 4);
+  *c = simdf_load_lanes(src + stride * 2, stride * 4);
+  *d = simdf_load_lanes(src + stride * 3, stride * 4);
+#endif
+  simdf_transpose_4x(a, b, c, d);
+}
+
+// the inverse of simdf_load_4x_strided(), the other floats of each structure
+// are left untouched.
+MATH_INLINE
+void
+simdf_store_4x_strided(
+  float *dst,
+  size_t stride,
+  simdf a,
+  simdf b,
+  simdf c,
+  simdf d)
+{
+  simdf_transpose_4x(&a, &b, &c, &d);
+#if SIMD_WIDTH == 1
+  (void)stride;
+  dst[0] = a;
+  dst[1] = b;
+  dst[2] = c;
+  dst[3] = d;
+#else
+  simdf_store_lanes(dst + stride * 0, stride * 4, a);
+  simdf_store_lanes(dst + stride * 1, stride * 4, b);
+  simdf_store_lanes(dst + stride * 2, stride * 4, c);
+  simdf_store_lanes(dst + stride * 3, stride * 4, d);
+#endif
+}
+
+// loads SIMD_WIDTH consecutive 4 float structures (quatf...) from 'src' and
+// splits their members into a, b, c and d.
+MATH_INLINE
+void
+simdf_load_4x(const float *src, simdf *a, simdf *b, simdf *c, simdf *d)
+{
+  simdf_load_4x_strided(src, 4, a, b, c, d);
+}
+
+// the inverse of simdf_load_4x().
+MATH_INLINE
+void
+simdf_store_4x(float *dst, simdf a, simdf b, simdf c, simdf d)
+{
+  simdf_store_4x_strided(dst, 4, a, b, c, d);
+}
+
+// splits the 4 xyz triplets held in each 128 bit lane, a = x0 y0 z0 x1,
+// b = y1 z1 x2 y2 and c = z2 x3 y3 z3, into a = x, b = y and c = z.
+MATH_INLINE
+void
+simdf_deinterleave_3x(simdf *a, simdf *b, simdf *c)
+{
+#if defined(MATH_SIMD_AVX512)
+  __m512 t0 = _mm512_shuffle_ps(*b, *c, 0x9e);
+  __m512 t1 = _mm512_shuffle_ps(*a, *b, 0x49);
+  *a = _mm512_shuffle_ps(*a, t0, 0x8c);
+  *b = _mm512_shuffle_ps(t1, t0, 0xd8);
+  *c = _mm512_shuffle_ps(t1, *c, 0xcd);
+#elif defined(MATH_SIMD_AVX2)
+  __m256 t0 = _mm256_shuffle_ps(*b, *c, 0x9e);
+  __m256 t1 = _mm256_shuffle_ps(*a, *b, 0x49);
+  *a = _mm256_shuffle_ps(*a, t0, 0x8c);
+  *b = _mm256_shuffle_ps(t1, t0, 0xd8);
+  *c = _mm256_shuffle_ps(t1, *c, 0xcd);
+#elif defined(MATH_SIMD_SSE2)
+  __m128 t0 = _mm_shuffle_ps(*b, *c, 0x9e);
+  __m128 t1 = _mm_shuffle_ps(*a, *b, 0x49);
+  *a = _mm_shuffle_ps(*a, t0, 0x8c);
+  *b = _mm_shuffle_ps(t1, t0, 0xd8);
+  *c = _mm_shuffle_ps(t1, *c, 0xcd);
+#else
+  (void)a, (void)b, (void)c;
+#endif
+}
+
+// the inverse of simdf_deinterleave_3x().
+MATH_INLINE
+void
+simdf_interleave_3x(simdf *a, simdf *b, simdf *c)
+{
+#if defined(MATH_SIMD_AVX512)
+  __m512 xy0 = _mm512_unpacklo_ps(*a, *b), xy1 = _mm512_unpackhi_ps(*a, *b);
+  __m512 t0 = _mm512_shuffle_ps(*c, *a, 0x50);
+  __m512 t1 = _mm512_shuffle_ps(*b, *c, 0x55);
+  __m512 t2 = _mm512_shuffle_ps(*c, xy1, 0xee);
+  *a = _mm512_shuffle_ps(xy0, t0, 0x84);
+  *b = _mm512_shuffle_ps(t1, xy1, 0x48);
+  *c = _mm512_shuffle_ps(t2, t2, 0x78);
+#elif defined(MATH_SIMD_AVX2)
+  __m256 xy0 = _mm256_unpacklo_ps(*a, *b), xy1 = _mm256_unpackhi_ps(*a, *b);
+  __m256 t0 = _mm256_shuffle_ps(*c, *a, 0x50);
+  __m256 t1 = _mm256_shuffle_ps(*b, *c, 0x55);
+  __m256 t2 = _mm256_shuffle_ps(*c, xy1, 0xee);
+  *a = _mm256_shuffle_ps(xy0, t0, 0x84);
+  *b = _mm256_shuffle_ps(t1, xy1, 0x48);
+  *c = _mm256_shuffle_ps(t2, t2, 0x78);
+#elif defined(MATH_SIMD_SSE2)
+  __m128 xy0 = _mm_unpacklo_ps(*a, *b), xy1 = _mm_unpackhi_ps(*a, *b);
+  __m128 t0 = _mm_shuffle_ps(*c, *a, 0x50);
+  __m128 t1 = _mm_shuffle_ps(*b, *c, 0x55);
+  __m128 t2 = _mm_shuffle_ps(*c, xy1, 0xee);
+  *a = _mm_shuffle_ps(xy0, t0, 0x84);
+  *b = _mm_shuffle_ps(t1, xy1, 0x48);
+  *c = _mm_shuffle_ps(t2, t2, 0x78);
+#else
+  (void)a, (void)b, (void)c;
+#endif
+}
+
+// loads SIMD_WIDTH consecutive 3 float structures (vector3f...) from 'src' and
+// splits their members into x, y and z.
+MATH_INLINE
+void
+simdf_load_3x(const float *src, simdf *x, simdf *y, simdf *z)
+{
+#if SIMD_WIDTH == 1
+  *x = src[0];
+  *y = src[1];
+  *z = src[2];
+#else
+  *x = simdf_load_lanes(src + 0, 12);
+  *y = simdf_load_lanes(src + 4, 12);
+  *z = simdf_load_lanes(src + 8, 12);
+#endif
+  simdf_deinterleave_3x(x, y, z);
+}
+
+// the inverse of simdf_load_3x().
+MATH_INLINE
+void
+simdf_store_3x(float *dst, simdf x, simdf y, simdf z)
+{
+  simdf_interleave_3x(&x, &y, &z);
+#if SIMD_WIDTH == 1
+  dst[0] = x;
+  dst[1] = y;
+  dst[2] = z;
+#else
+  simdf_store_lanes(dst + 0, 12, x);
+  simdf_store_lanes(dst + 4, 12, y);
+  simdf_store_lanes(dst + 8, 12, z);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// approximate 1 / sqrt(src), relative error under 1.5 * 2^-12. The scalar path
+// has no estimate instruction and computes it exactly.
+MATH_INLINE
+simdf
+rsqrt_simdf(simdf src)
+{
+#if defined(MATH_SIMD_AVX512)
+  return _mm512_rsqrt14_ps(src);
+#elif defined(MATH_SIMD_AVX2)
+  return _mm256_rsqrt_ps(src);
+#elif defined(MATH_SIMD_SSE2)
+  return _mm_rsqrt_ps(src);
+#else
+  return 1.f / sqrtf(src);
+#endif
+}
+
+// rsqrt_simdf() refined by one newton step, relative error around 2^-22.
+MATH_INLINE
+simdf
+rsqrt_nr_simdf(simdf src)
+{
+#if defined(MATH_SIMD_AVX2) || defined(MATH_SIMD_SSE2)
+  simdf estimate = rsqrt_simdf(src);
+  simdf half = mult_simdf(src, simdf_set_1f(0.5f));
+  return mult_simdf(
+    estimate,
+    sub_simdf(
+      simdf_set_1f(1.5f), mult_simdf(half, mult_simdf(estimate, estimate))));
+#else
+  return 1.f / sqrtf(src);
+#endif
+}
+
+// single value versions of the above for the scalar api, the precision tiers
+// follow common.h: 'np' is within EPSILON_FLOAT_MIN_PRECISION and 'mp' within
+// EPSILON_FLOAT_MED_PRECISION (relative).
+MATH_INLINE
+float
+rsqrtf_np(float value)
+{
+#if defined(MATH_SIMD_AVX2) || defined(MATH_SIMD_SSE2)
+  return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+#else
+  return 1.f / sqrtf(value);
+#endif
+}
+
+MATH_INLINE
+float
+rsqrtf_mp(float value)
+{
+#if defined(MATH_SIMD_AVX2) || defined(MATH_SIMD_SSE2)
+  float estimate = rsqrtf_np(value);
+  return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#else
+  return 1.f / sqrtf(value);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file transform.h
+ * @author khalilhenoud@gmail.com
+ * @brief affine (3x4) and rigid (rotation + translation) transforms, the
+ * matrix4f without its constant bottom row.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_TRANSFORM_H
+#define C_TRANSFORM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <math/matrix4f.h>
+#include <math/vector3f.h>
+
+
+// same order as the first 12 entries of M4_RC_XX, row 3 is always 0 0 0 1.
+typedef
+enum {
+  A3_RC_00,
+  A3_RC_01,
+  A3_RC_02,
+  A3_RC_03,
+  A3_RC_10,
+  A3_RC_11,
+  A3_RC_12,
+  A3_RC_13,
+  A3_RC_20,
+  A3_RC_21,
+  A3_RC_22,
+  A3_RC_23
+} A3_RC_XX;
+
+// any invertible linear part (rotation, scale, shear) plus a translation.
+typedef
+struct affine3f {
+  float data[12];
+} affine3f;
+
+// same layout as affine3f, the 3x3 part is a pure rotation (orthonormal).
+typedef
+struct rigid3f {
+  float data[12];
+} rigid3f;
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+void
+affine3f_set_identity(affine3f *dst);
+
+// drops the bottom row of 'src', which should be 0 0 0 1.
+MATH_INLINE
+void
+affine3f_set_from_matrix4f(affine3f *dst, const matrix4f *src);
+
+MATH_INLINE
+void
+affine3f_set_from_rigid3f(affine3f *dst, const rigid3f *src);
+
+MATH_INLINE
+matrix4f
+affine3f_to_matrix4f(const affine3f *src);
+
+// applies 'rhs' then 'lhs', like mult_m4f().
+MATH_INLINE
+affine3f
+mult_affine3f(const affine3f *lhs, const affine3f *rhs);
+
+MATH_INLINE
+void
+mult_set_affine3f(affine3f *dst, const affine3f *rhs);
+
+MATH_INLINE
+point3f
+mult_affine3f_p3f(const affine3f *lhs, const point3f *rhs);
+
+// ignores the translation.
+MATH_INLINE
+vector3f
+mult_affine3f_v3f(const affine3f *lhs, const vector3f *rhs);
+
+// inverts the 3x3 part with its adjugate, one determinant against the sixteen
+// inverse_m4f() computes. 'src' must be invertible.
+MATH_INLINE
+affine3f
+inverse_affine3f(const affine3f *src);
+
+MATH_INLINE
+void
+inverse_set_affine3f(affine3f *dst);
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+void
+rigid3f_set_identity(rigid3f *dst);
+
+// drops the bottom row of 'src', the 3x3 part must be a rotation.
+MATH_INLINE
+void
+rigid3f_set_from_matrix4f(rigid3f *dst, const matrix4f *src);
+
+MATH_INLINE
+void
+rigid3f_set_from_matrix3f_v3f(
+  rigid3f *dst,
+  const matrix3f *rotation,
+  const vector3f *translation);
+
+MATH_INLINE
+matrix4f
+rigid3f_to_matrix4f(const rigid3f *src);
+
+MATH_INLINE
+rigid3f
+mult_rigid3f(const rigid3f *lhs, const rigid3f *rhs);
+
+MATH_INLINE
+void
+mult_set_rigid3f(rigid3f *dst, const rigid3f *rhs);
+
+MATH_INLINE
+point3f
+mult_rigid3f_p3f(const rigid3f *lhs, const point3f *rhs);
+
+MATH_INLINE
+vector3f
+mult_rigid3f_v3f(const rigid3f *lhs, const vector3f *rhs);
+
+// the transposed rotation and the translation rotated back and negated.
+MATH_INLINE
+rigid3f
+inverse_rigid3f(const rigid3f *src);
+
+MATH_INLINE
+void
+inverse_set_rigid3f(rigid3f *dst);
+
+#include "transform.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
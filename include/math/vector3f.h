@@ -18,6 +18,7 @@ extern "C" {
 #include <math.h>
 #include <float.h>
 #include <math/common.h>
+#include <math/simd.h>
 
 
 typedef
@@ -28,14 +29,14 @@ struct vector3f {
 typedef vector3f point3f;
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 void
 vector3f_set_1f(vector3f *dst, float value)
 {
   dst->data[0] = dst->data[1] = dst->data[2] = value;
 }
 
-inline
+MATH_INLINE
 void
 vector3f_set_3f(vector3f *dst, float x, float y, float z)
 {
@@ -44,7 +45,7 @@ vector3f_set_3f(vector3f *dst, float x, float y, float z)
   dst->data[2] = z;
 }
 
-inline
+MATH_INLINE
 void
 vector3f_copy(vector3f *dst, const vector3f *src)
 {
@@ -53,7 +54,7 @@ vector3f_copy(vector3f *dst, const vector3f *src)
   dst->data[2] = src->data[2];
 }
 
-inline
+MATH_INLINE
 void
 vector3f_set_a3f(vector3f *dst, const float* data)
 {
@@ -62,7 +63,7 @@ vector3f_set_a3f(vector3f *dst, const float* data)
   dst->data[2] = data[2];
 }
 
-inline
+MATH_INLINE
 void
 vector3f_set_diff_v3f(vector3f *dst, const vector3f *lhs, const vector3f *rhs)
 {
@@ -72,7 +73,7 @@ vector3f_set_diff_v3f(vector3f *dst, const vector3f *lhs, const vector3f *rhs)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 float
 length_v3f(const vector3f *src)
 {
@@ -82,7 +83,7 @@ length_v3f(const vector3f *src)
     src->data[2] * src->data[2]);
 }
 
-inline
+MATH_INLINE
 float
 length_squared_v3f(const vector3f *src)
 {
@@ -92,7 +93,7 @@ length_squared_v3f(const vector3f *src)
     src->data[2] * src->data[2];
 }
 
-inline
+MATH_INLINE
 float
 dot_product_v3f(const vector3f *lhs, const vector3f *rhs)
 {
@@ -102,7 +103,7 @@ dot_product_v3f(const vector3f *lhs, const vector3f *rhs)
     lhs->data[2] * rhs->data[2];
 }
 
-inline
+MATH_INLINE
 vector3f
 cross_product_v3f(const vector3f *lhs, const vector3f *rhs)
 {
@@ -113,7 +114,7 @@ cross_product_v3f(const vector3f *lhs, const vector3f *rhs)
   return dst;
 }
 
-inline
+MATH_INLINE
 vector3f
 normalize_v3f(const vector3f *src)
 {
@@ -125,7 +126,7 @@ normalize_v3f(const vector3f *src)
   return vec;
 }
 
-inline
+MATH_INLINE
 void
 normalize_set_v3f(vector3f *dst)
 {
@@ -135,7 +136,53 @@ normalize_set_v3f(vector3f *dst)
   dst->data[2] /= length;
 }
 
-inline
+// precision tiers of normalize_v3f()/normalize_set_v3f() without divisions,
+// see rsqrtf_mp() and rsqrtf_np().
+MATH_INLINE
+vector3f
+normalize_v3f_mp(const vector3f *src)
+{
+  float scale = rsqrtf_mp(length_squared_v3f(src));
+  vector3f vec;
+  vec.data[0] = src->data[0] * scale;
+  vec.data[1] = src->data[1] * scale;
+  vec.data[2] = src->data[2] * scale;
+  return vec;
+}
+
+MATH_INLINE
+vector3f
+normalize_v3f_np(const vector3f *src)
+{
+  float scale = rsqrtf_np(length_squared_v3f(src));
+  vector3f vec;
+  vec.data[0] = src->data[0] * scale;
+  vec.data[1] = src->data[1] * scale;
+  vec.data[2] = src->data[2] * scale;
+  return vec;
+}
+
+MATH_INLINE
+void
+normalize_set_v3f_mp(vector3f *dst)
+{
+  float scale = rsqrtf_mp(length_squared_v3f(dst));
+  dst->data[0] *= scale;
+  dst->data[1] *= scale;
+  dst->data[2] *= scale;
+}
+
+MATH_INLINE
+void
+normalize_set_v3f_np(vector3f *dst)
+{
+  float scale = rsqrtf_np(length_squared_v3f(dst));
+  dst->data[0] *= scale;
+  dst->data[1] *= scale;
+  dst->data[2] *= scale;
+}
+
+MATH_INLINE
 int32_t
 equal_to_v3f(const vector3f *lhs, const vector3f *rhs)
 {
@@ -145,7 +192,7 @@ equal_to_v3f(const vector3f *lhs, const vector3f *rhs)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-inline
+MATH_INLINE
 vector3f
 negate_v3f(const vector3f *src)
 {
@@ -156,7 +203,7 @@ negate_v3f(const vector3f *src)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 negate_set_v3f(vector3f *dst)
 {
@@ -165,7 +212,7 @@ negate_set_v3f(vector3f *dst)
   dst->data[2] *= -1.f;
 }
 
-inline
+MATH_INLINE
 vector3f
 diff_v3f(const vector3f *lhs, const vector3f *rhs)
 {
@@ -176,7 +223,7 @@ diff_v3f(const vector3f *lhs, const vector3f *rhs)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 diff_set_v3f(vector3f *dst, const vector3f *sub)
 {
@@ -185,7 +232,7 @@ diff_set_v3f(vector3f *dst, const vector3f *sub)
   dst->data[2] -= sub->data[2];
 }
 
-inline
+MATH_INLINE
 vector3f
 add_v3f(const vector3f *lhs, const vector3f *rhs)
 {
@@ -196,7 +243,7 @@ add_v3f(const vector3f *lhs, const vector3f *rhs)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 add_set_v3f(vector3f *dst, const vector3f *add)
 {
@@ -205,7 +252,7 @@ add_set_v3f(vector3f *dst, const vector3f *add)
   dst->data[2] += add->data[2];
 }
 
-inline
+MATH_INLINE
 vector3f
 mult_v3f(const vector3f *lhs, float scale)
 {
@@ -216,7 +263,7 @@ mult_v3f(const vector3f *lhs, float scale)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 mult_set_v3f(vector3f *dst, float scale)
 {
@@ -225,7 +272,7 @@ mult_set_v3f(vector3f *dst, float scale)
   dst->data[2] *= scale;
 }
 
-inline
+MATH_INLINE
 vector3f
 div_v3f(const vector3f *lhs, float scale)
 {
@@ -236,7 +283,7 @@ div_v3f(const vector3f *lhs, float scale)
   return dst;
 }
 
-inline
+MATH_INLINE
 void
 div_set_v3f(vector3f *dst, float scale)
 {
@@ -245,7 +292,7 @@ div_set_v3f(vector3f *dst, float scale)
   dst->data[2] /= scale;
 }
 
-inline
+MATH_INLINE
 vector3f
 lerp_v3f(vector3f src, vector3f dst, float lerp_factor)
 {
@@ -0,0 +1,156 @@
+/**
+ * @file vector3f_soa.h
+ * @author khalilhenoud@gmail.com
+ * @brief structure of arrays container for vector3f, with batch variants of the
+ * vector3f operations.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_VECTOR_3F_SOA_H
+#define C_VECTOR_3F_SOA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <math/vector3f.h>
+#include <math/simd.h>
+
+
+// streams are aligned and padded to a cache line, whatever the lane width.
+#define VECTOR3F_SOA_ALIGNMENT 64
+#define VECTOR3F_SOA_PADDING (VECTOR3F_SOA_ALIGNMENT / sizeof(float))
+
+// NOTE: the container does not own its memory, see vector3f_soa_set_buffer().
+typedef
+struct vector3f_soa_t {
+  float *x;
+  float *y;
+  float *z;
+  uint32_t count;
+} vector3f_soa_t;
+
+// size in bytes of the buffer required to hold 'count' vectors.
+MATH_INLINE
+size_t
+get_vector3f_soa_buffer_size(uint32_t count);
+
+// splits 'buffer' into the x, y and z streams. 'buffer' must be aligned to
+// VECTOR3F_SOA_ALIGNMENT and be at least get_vector3f_soa_buffer_size() bytes.
+MATH_INLINE
+void
+vector3f_soa_set_buffer(
+  vector3f_soa_t *dst,
+  void *buffer,
+  uint32_t count);
+
+// fills every stream, 'count' must be the count of 'dst'.
+MATH_INLINE
+void
+vector3f_soa_set_from_aos(
+  vector3f_soa_t *dst,
+  const vector3f *src,
+  uint32_t count);
+
+MATH_INLINE
+void
+vector3f_soa_to_aos(
+  const vector3f_soa_t *src,
+  vector3f *dst);
+
+////////////////////////////////////////////////////////////////////////////////
+// NOTE: 'dst' may alias any of the inputs, all operands hold the same count.
+MATH_INLINE
+void
+length_v3f_soa(
+  const vector3f_soa_t *src,
+  float *lengths);
+
+MATH_INLINE
+void
+length_squared_v3f_soa(
+  const vector3f_soa_t *src,
+  float *lengths);
+
+MATH_INLINE
+void
+dot_product_v3f_soa(
+  const vector3f_soa_t *lhs,
+  const vector3f_soa_t *rhs,
+  float *dots);
+
+MATH_INLINE
+void
+cross_product_v3f_soa(
+  const vector3f_soa_t *lhs,
+  const vector3f_soa_t *rhs,
+  vector3f_soa_t *dst);
+
+MATH_INLINE
+void
+normalize_v3f_soa(
+  const vector3f_soa_t *src,
+  vector3f_soa_t *dst);
+
+// precision tiers of normalize_v3f_soa() without divisions, see
+// rsqrt_nr_simdf() and rsqrt_simdf().
+MATH_INLINE
+void
+normalize_v3f_soa_mp(
+  const vector3f_soa_t *src,
+  vector3f_soa_t *dst);
+
+MATH_INLINE
+void
+normalize_v3f_soa_np(
+  const vector3f_soa_t *src,
+  vector3f_soa_t *dst);
+
+////////////////////////////////////////////////////////////////////////////////
+MATH_INLINE
+void
+negate_v3f_soa(
+  const vector3f_soa_t *src,
+  vector3f_soa_t *dst);
+
+// same convention as diff_v3f(), dst = rhs - lhs.
+MATH_INLINE
+void
+diff_v3f_soa(
+  const vector3f_soa_t *lhs,
+  const vector3f_soa_t *rhs,
+  vector3f_soa_t *dst);
+
+MATH_INLINE
+void
+add_v3f_soa(
+  const vector3f_soa_t *lhs,
+  const vector3f_soa_t *rhs,
+  vector3f_soa_t *dst);
+
+MATH_INLINE
+void
+mult_v3f_soa(
+  const vector3f_soa_t *src,
+  float scale,
+  vector3f_soa_t *dst);
+
+MATH_INLINE
+void
+lerp_v3f_soa(
+  const vector3f_soa_t *src,
+  const vector3f_soa_t *dst,
+  float lerp_factor,
+  vector3f_soa_t *result);
+
+#include "vector3f_soa.impl"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
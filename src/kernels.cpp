@@ -0,0 +1,125 @@
+/**
+ * @file kernels.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief picks the kernels table matching the cpu.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <stddef.h>
+#include <stdint.h>
+#if defined(MATH_KERNELS_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(MATH_KERNELS_X86)
+#include <cpuid.h>
+#endif
+#include "kernels_private.h"
+
+
+#if defined(MATH_KERNELS_X86)
+static
+void
+kernels_cpuid(uint32_t leaf, uint32_t sub_leaf, uint32_t registers[4])
+{
+#if defined(_MSC_VER)
+  __cpuidex((int *)registers, (int)leaf, (int)sub_leaf);
+#else
+  __cpuid_count(
+    leaf, sub_leaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+}
+
+// register state the os saves on context switches, only valid if the cpu
+// reports OSXSAVE.
+static
+uint64_t
+kernels_xgetbv(void)
+{
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+static
+int32_t
+kernels_supported(MATH_KERNELS_ISA isa)
+{
+  uint32_t leaf0[4], leaf1[4], leaf7[4] = { 0, 0, 0, 0 };
+  uint64_t xcr0 = 0;
+
+  if (isa == MATH_KERNELS_SCALAR)
+    return 1;
+
+  kernels_cpuid(0, 0, leaf0);
+  kernels_cpuid(1, 0, leaf1);
+  if (leaf0[0] >= 7)
+    kernels_cpuid(7, 0, leaf7);
+  if (leaf1[2] & (1u << 27))
+    xcr0 = kernels_xgetbv();
+
+  switch (isa) {
+    case MATH_KERNELS_SSE41:
+      return (leaf1[2] & (1u << 19)) != 0;
+    case MATH_KERNELS_AVX2:
+      // AVX, FMA, AVX2 and the ymm state saved by the os.
+      return
+        (leaf1[2] & (1u << 28)) && (leaf1[2] & (1u << 12)) &&
+        (leaf7[1] & (1u << 5)) && (xcr0 & 0x6) == 0x6;
+    case MATH_KERNELS_AVX512:
+      // AVX2 plus AVX-512 F, DQ, BW, VL and the opmask/zmm state.
+      return
+        kernels_supported(MATH_KERNELS_AVX2) &&
+        (leaf7[1] & (1u << 16)) && (leaf7[1] & (1u << 17)) &&
+        (leaf7[1] & (1u << 30)) && (leaf7[1] & (1u << 31)) &&
+        (xcr0 & 0xe6) == 0xe6;
+    default:
+      return 0;
+  }
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+const math_kernels_t *
+get_math_kernels_isa(MATH_KERNELS_ISA isa)
+{
+#if defined(MATH_KERNELS_X86)
+  static const math_kernels_t *tables[MATH_KERNELS_COUNT] = {
+    &math_kernels_scalar,
+    &math_kernels_sse41,
+    &math_kernels_avx2,
+    &math_kernels_avx512 };
+
+  if (isa >= MATH_KERNELS_COUNT || !kernels_supported(isa))
+    return NULL;
+  return tables[isa];
+#else
+  return isa == MATH_KERNELS_SCALAR ? &math_kernels_scalar : NULL;
+#endif
+}
+
+// best first, the scalar table is always there.
+static
+const math_kernels_t *
+kernels_select(void)
+{
+  for (uint32_t i = MATH_KERNELS_COUNT - 1; i > MATH_KERNELS_SCALAR; --i) {
+    const math_kernels_t *table = get_math_kernels_isa((MATH_KERNELS_ISA)i);
+    if (table)
+      return table;
+  }
+  return &math_kernels_scalar;
+}
+
+const math_kernels_t *
+get_math_kernels(void)
+{
+  // initialized once, thread safe.
+  static const math_kernels_t *kernels = kernels_select();
+  return kernels;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file kernels_avx2.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief kernels built with AVX2 and FMA.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define MATH_INLINE static inline
+#define MATH_KERNELS_TABLE math_kernels_avx2
+#define MATH_KERNELS_TABLE_ISA MATH_KERNELS_AVX2
+#define MATH_KERNELS_TABLE_NAME "avx2"
+#include "kernels_table.inl"
@@ -0,0 +1,15 @@
+/**
+ * @file kernels_avx512.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief kernels built with AVX-512 (F, VL, BW, DQ), 16 lanes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define MATH_INLINE static inline
+#define MATH_KERNELS_TABLE math_kernels_avx512
+#define MATH_KERNELS_TABLE_ISA MATH_KERNELS_AVX512
+#define MATH_KERNELS_TABLE_NAME "avx512"
+#include "kernels_table.inl"
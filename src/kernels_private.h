@@ -0,0 +1,33 @@
+/**
+ * @file kernels_private.h
+ * @author khalilhenoud@gmail.com
+ * @brief the per instruction set tables, only the ones built for the target
+ * processor exist (see CMakeLists.txt).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#ifndef C_KERNELS_PRIVATE_H
+#define C_KERNELS_PRIVATE_H
+
+#include <math/kernels.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern const math_kernels_t math_kernels_scalar;
+#if defined(MATH_KERNELS_X86)
+extern const math_kernels_t math_kernels_sse41;
+extern const math_kernels_t math_kernels_avx2;
+extern const math_kernels_t math_kernels_avx512;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
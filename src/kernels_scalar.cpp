@@ -0,0 +1,17 @@
+/**
+ * @file kernels_scalar.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief reference kernels with the SIMD paths disabled, used when no other
+ * instruction set is available.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define MATH_SIMD_DISABLE
+#define MATH_INLINE static inline
+#define MATH_KERNELS_TABLE math_kernels_scalar
+#define MATH_KERNELS_TABLE_ISA MATH_KERNELS_SCALAR
+#define MATH_KERNELS_TABLE_NAME "scalar"
+#include "kernels_table.inl"
@@ -0,0 +1,15 @@
+/**
+ * @file kernels_sse41.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief kernels built with SSE4.1, the SSE2 paths of the headers.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#define MATH_INLINE static inline
+#define MATH_KERNELS_TABLE math_kernels_sse41
+#define MATH_KERNELS_TABLE_ISA MATH_KERNELS_SSE41
+#define MATH_KERNELS_TABLE_NAME "sse4.1"
+#include "kernels_table.inl"
@@ -0,0 +1,98 @@
+/**
+ * @file kernels_table.inl
+ * @author khalilhenoud@gmail.com
+ * @brief builds the kernels table of one instruction set, included by the
+ * kernels_<isa>.cpp files once they define MATH_KERNELS_TABLE (the table
+ * name), MATH_KERNELS_TABLE_ISA and MATH_KERNELS_TABLE_NAME.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+// NOTE: every kernels_<isa>.cpp compiles the same inline headers with its own
+// instruction set. Inline functions left out of line are merged by the linker
+// across translation units, which could then call the AVX2 copy of a function
+// on any cpu. The kernels_<isa>.cpp files define MATH_INLINE as 'static inline'
+// so each translation unit keeps its own copies, which only works if no math
+// header was included before.
+#if defined(C_COMMON_H)
+#error "kernels_table.inl must be included before any math header!"
+#endif
+#if !defined(MATH_INLINE)
+#error "MATH_INLINE must be defined as 'static inline'!"
+#endif
+
+#include <math/capsule_batch.h>
+#include <math/dualquatf_batch.h>
+#include <math/face.h>
+#include <math/frustum.h>
+#include <math/matrix4f.h>
+#include <math/matrix4f_batch.h>
+#include <math/plane_batch.h>
+#include <math/quatf_batch.h>
+#include <math/ray_batch.h>
+#include <math/segment_batch.h>
+#include <math/vector3f_soa.h>
+
+#include "kernels_private.h"
+
+
+extern "C" const math_kernels_t MATH_KERNELS_TABLE = {
+  MATH_KERNELS_TABLE_ISA,
+  MATH_KERNELS_TABLE_NAME,
+
+  length_v3f_soa,
+  length_squared_v3f_soa,
+  dot_product_v3f_soa,
+  cross_product_v3f_soa,
+  normalize_v3f_soa,
+  normalize_v3f_soa_mp,
+  normalize_v3f_soa_np,
+  negate_v3f_soa,
+  diff_v3f_soa,
+  add_v3f_soa,
+  mult_v3f_soa,
+  lerp_v3f_soa,
+
+  mult_m4f,
+  mult_m4f_p3f_strided,
+  mult_m4f_v3f_strided,
+  mult_m4f_p3f_array,
+  mult_m4f_v3f_array,
+
+  slerp_quatf_array,
+  nlerp_quatf_array,
+  mult_quatf_v3f_array,
+  mult_quatf_v3f_soa,
+  mult_quatf_v3f_pairwise,
+  quatf_set_from_rotation_matrix4f_array,
+  quatf_set_from_rotation_matrix3f_array,
+  quatf_to_matrix4f_array,
+  quatf_to_matrix3f_array,
+  quatf_to_matrix3x4f_array,
+
+  skin_dualquatf_array,
+
+  closest_point_on_segment_soa,
+  get_point_distance_to_line_soa,
+  closest_point_on_segment_array,
+  closest_points_on_segments_soa,
+
+  get_faces_normals_fast,
+  get_faces_normals_partition,
+
+  get_plane_distance_soa,
+  classify_plane_soa,
+  get_face_cache_distance,
+  classify_face_cache,
+
+  cull_spheres_frustum,
+  cull_capsules_frustum,
+
+  raycast_faces_soa,
+  raycast_face_soa,
+
+  get_oriented_capsule_segment_soa,
+  get_oriented_capsule_aabb_array
+};
@@ -0,0 +1,1733 @@
+/**
+ * @file kernels_test.cpp
+ * @author khalilhenoud@gmail.com
+ * @brief checks every entry of every kernels table the cpu supports against
+ * the single element functions of the headers, on random, degenerate and tail
+ * sized inputs.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * usage: math_kernels_test, returns 0 when every check passes.
+ */
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math/kernels.h>
+
+
+// the counts cover a single element, partial and full simd widths (4, 8 and
+// 16 lanes) and a tail after several full iterations.
+#define TEST_MAX_COUNT 64
+#define TEST_ARENA_SIZE (1 << 20)
+#define TEST_MAX_FAILURES 32
+#define TEST_BONE_COUNT 8
+#define TEST_INFLUENCES 3
+#define TEST_RAY_FACES 5
+
+// relative to max(1, |expected|). The instruction sets contract multiply-adds
+// differently, the default leaves room for the cancellation in the products.
+#define TEST_TOLERANCE 1e-5f
+#define TEST_TOLERANCE_MP (2 * EPSILON_FLOAT_MED_PRECISION)
+#define TEST_TOLERANCE_NP (2 * EPSILON_FLOAT_MIN_PRECISION)
+// the bodies this close to a plane are not classified, both answers are right.
+#define TEST_MARGIN 1e-3f
+
+typedef void (*test_function_t)(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate);
+
+typedef
+struct test_t {
+  const char *name;
+  test_function_t function;
+} test_t;
+
+static const char *g_table;
+static const char *g_kernel;
+static uint32_t g_count;
+static int32_t g_degenerate;
+static uint32_t g_checks;
+static uint32_t g_failures;
+
+// the soa streams must be aligned, every case starts with an empty arena.
+static uint8_t g_arena[TEST_ARENA_SIZE + VECTOR3F_SOA_ALIGNMENT];
+static size_t g_arena_used;
+
+static vector3f g_lhs[TEST_MAX_COUNT];
+static vector3f g_rhs[TEST_MAX_COUNT];
+static vector3f g_out[TEST_MAX_COUNT];
+static float g_floats[TEST_MAX_COUNT];
+static quatf g_quats[2][TEST_MAX_COUNT];
+static quatf g_quats_out[TEST_MAX_COUNT];
+static matrix4f g_matrices[TEST_MAX_COUNT];
+static matrix3f g_matrices3[TEST_MAX_COUNT];
+static rigid3f g_rigids[TEST_MAX_COUNT];
+static face_t g_faces[TEST_MAX_COUNT];
+static segment_t g_segments[2][TEST_MAX_COUNT];
+
+////////////////////////////////////////////////////////////////////////////////
+// xorshift32, the inputs are the same from one run to the next.
+static uint32_t g_seed = 0x9e3779b9;
+
+static
+uint32_t
+test_random_u32(void)
+{
+  g_seed ^= g_seed << 13;
+  g_seed ^= g_seed >> 17;
+  g_seed ^= g_seed << 5;
+  return g_seed;
+}
+
+// in [0, 1).
+static
+float
+test_random(void)
+{
+  return (test_random_u32() >> 8) / (float)(1 << 24);
+}
+
+static
+void
+test_random_v3f(vector3f *dst, float scale)
+{
+  vector3f_set_3f(
+    dst,
+    (test_random() * 2.f - 1.f) * scale,
+    (test_random() * 2.f - 1.f) * scale,
+    (test_random() * 2.f - 1.f) * scale);
+}
+
+static
+void
+test_random_unit_v3f(vector3f *dst)
+{
+  do {
+    test_random_v3f(dst, 1.f);
+  } while (length_squared_v3f(dst) < 0.01f);
+  normalize_set_v3f(dst);
+}
+
+// unit, either sign.
+static
+void
+test_random_quatf(quatf *dst)
+{
+  vector3f axis;
+  test_random_unit_v3f(&axis);
+  quatf_set_from_axis_angle(dst, &axis, test_random() * 6.f);
+  if (test_random() < 0.5f)
+    mult_set_quatf_f(dst, -1.f);
+}
+
+static
+void *
+test_alloc(size_t size)
+{
+  uintptr_t base =
+    ((uintptr_t)g_arena + VECTOR3F_SOA_ALIGNMENT - 1) &
+    ~(uintptr_t)(VECTOR3F_SOA_ALIGNMENT - 1);
+  void *result = (void *)(base + g_arena_used);
+
+  g_arena_used +=
+    (size + VECTOR3F_SOA_ALIGNMENT - 1) /
+    VECTOR3F_SOA_ALIGNMENT * VECTOR3F_SOA_ALIGNMENT;
+  if (g_arena_used > TEST_ARENA_SIZE) {
+    fprintf(stderr, "%s: the test arena is too small\n", g_kernel);
+    exit(1);
+  }
+  return result;
+}
+
+// 'src' is optional.
+static
+void
+test_soa_set(vector3f_soa_t *dst, const vector3f *src, uint32_t count)
+{
+  vector3f_soa_set_buffer(
+    dst, test_alloc(get_vector3f_soa_buffer_size(count)), count);
+  if (src)
+    vector3f_soa_set_from_aos(dst, src, count);
+}
+
+static
+void
+test_segment_soa_set(segment_soa_t *dst, const segment_t *src, uint32_t count)
+{
+  for (uint32_t k = 0; k < 2; ++k) {
+    test_soa_set(dst->points + k, NULL, count);
+    for (uint32_t i = 0; i < count; ++i) {
+      dst->points[k].x[i] = src[i].points[k].data[0];
+      dst->points[k].y[i] = src[i].points[k].data[1];
+      dst->points[k].z[i] = src[i].points[k].data[2];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// NaNs match NaNs, infinities match the same infinity.
+static
+void
+test_check(float value, float expected, float tolerance, uint32_t index)
+{
+  int32_t passed;
+  ++g_checks;
+  if (isnan(expected) || isnan(value))
+    passed = isnan(expected) && isnan(value);
+  else if (isinf(expected) || isinf(value))
+    passed = value == expected;
+  else
+    passed =
+      fabsf(value - expected) <= tolerance * fmaxf(1.f, fabsf(expected));
+
+  if (passed)
+    return;
+  if (++g_failures <= TEST_MAX_FAILURES)
+    printf(
+      "FAILED %s %s, count %u, %s, element %u: %.9g expected %.9g\n",
+      g_table, g_kernel, g_count, g_degenerate ? "degenerate" : "random",
+      index, value, expected);
+}
+
+static
+void
+test_check_floats(
+  const float *value,
+  const float *expected,
+  uint32_t count,
+  float tolerance,
+  uint32_t index)
+{
+  for (uint32_t i = 0; i < count; ++i)
+    test_check(value[i], expected[i], tolerance, index);
+}
+
+static
+void
+test_check_v3f(
+  const vector3f *value,
+  const vector3f *expected,
+  float tolerance,
+  uint32_t index)
+{
+  test_check_floats(value->data, expected->data, 3, tolerance, index);
+}
+
+// the bits set in 'ignored' are not compared.
+static
+void
+test_check_bits(
+  uint32_t value,
+  uint32_t expected,
+  uint32_t ignored,
+  uint32_t index)
+{
+  test_check(
+    (float)((value ^ expected) & ~ignored), 0.f, 0.f, index);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the degenerate operands are zero, equal or opposite vectors.
+static
+void
+test_set_v3f_pair(uint32_t count, int32_t degenerate)
+{
+  for (uint32_t i = 0; i < count; ++i) {
+    test_random_v3f(g_lhs + i, 4.f);
+    test_random_v3f(g_rhs + i, 4.f);
+    if (!degenerate)
+      continue;
+
+    switch (i % 4) {
+      case 0:
+        vector3f_set_1f(g_lhs + i, 0.f);
+        break;
+      case 1:
+        g_rhs[i] = g_lhs[i];
+        break;
+      case 2:
+        g_rhs[i] = negate_v3f(g_lhs + i);
+        break;
+      default:
+        vector3f_set_1f(g_rhs + i, 0.f);
+        break;
+    }
+  }
+}
+
+static
+void
+test_unary_v3f_soa(
+  void (*kernel)(const vector3f_soa_t *, vector3f_soa_t *),
+  vector3f (*reference)(const vector3f *),
+  uint32_t count,
+  int32_t degenerate,
+  float tolerance)
+{
+  vector3f_soa_t src, dst;
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&src, g_lhs, count);
+  test_soa_set(&dst, NULL, count);
+
+  kernel(&src, &dst);
+  vector3f_soa_to_aos(&dst, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = reference(g_lhs + i);
+    test_check_v3f(g_out + i, &expected, tolerance, i);
+  }
+}
+
+static
+void
+test_binary_v3f_soa(
+  void (*kernel)(
+    const vector3f_soa_t *, const vector3f_soa_t *, vector3f_soa_t *),
+  vector3f (*reference)(const vector3f *, const vector3f *),
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t lhs, rhs, dst;
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&lhs, g_lhs, count);
+  test_soa_set(&rhs, g_rhs, count);
+  test_soa_set(&dst, NULL, count);
+
+  kernel(&lhs, &rhs, &dst);
+  vector3f_soa_to_aos(&dst, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = reference(g_lhs + i, g_rhs + i);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_length_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t src;
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&src, g_lhs, count);
+
+  kernels->length_v3f_soa(&src, g_floats);
+  for (uint32_t i = 0; i < count; ++i)
+    test_check(g_floats[i], length_v3f(g_lhs + i), TEST_TOLERANCE, i);
+}
+
+static
+void
+test_length_squared_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t src;
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&src, g_lhs, count);
+
+  kernels->length_squared_v3f_soa(&src, g_floats);
+  for (uint32_t i = 0; i < count; ++i)
+    test_check(
+      g_floats[i], length_squared_v3f(g_lhs + i), TEST_TOLERANCE, i);
+}
+
+static
+void
+test_dot_product_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t lhs, rhs;
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&lhs, g_lhs, count);
+  test_soa_set(&rhs, g_rhs, count);
+
+  kernels->dot_product_v3f_soa(&lhs, &rhs, g_floats);
+  for (uint32_t i = 0; i < count; ++i)
+    test_check(
+      g_floats[i], dot_product_v3f(g_lhs + i, g_rhs + i), TEST_TOLERANCE, i);
+}
+
+static
+void
+test_cross_product_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_binary_v3f_soa(
+    kernels->cross_product_v3f_soa, cross_product_v3f, count, degenerate);
+}
+
+static
+void
+test_normalize_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_unary_v3f_soa(
+    kernels->normalize_v3f_soa, normalize_v3f, count, degenerate,
+    TEST_TOLERANCE);
+}
+
+static
+void
+test_normalize_v3f_soa_mp(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_unary_v3f_soa(
+    kernels->normalize_v3f_soa_mp, normalize_v3f_mp, count, degenerate,
+    TEST_TOLERANCE_MP);
+}
+
+static
+void
+test_normalize_v3f_soa_np(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_unary_v3f_soa(
+    kernels->normalize_v3f_soa_np, normalize_v3f_np, count, degenerate,
+    TEST_TOLERANCE_NP);
+}
+
+static
+void
+test_negate_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_unary_v3f_soa(
+    kernels->negate_v3f_soa, negate_v3f, count, degenerate, 0.f);
+}
+
+static
+void
+test_diff_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_binary_v3f_soa(kernels->diff_v3f_soa, diff_v3f, count, degenerate);
+}
+
+static
+void
+test_add_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_binary_v3f_soa(kernels->add_v3f_soa, add_v3f, count, degenerate);
+}
+
+static
+void
+test_mult_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t src, dst;
+  float scale = degenerate ? 0.f : test_random() * 4.f - 2.f;
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&src, g_lhs, count);
+  test_soa_set(&dst, NULL, count);
+
+  kernels->mult_v3f_soa(&src, scale, &dst);
+  vector3f_soa_to_aos(&dst, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = mult_v3f(g_lhs + i, scale);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_lerp_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t src, dst, result;
+  float factor = degenerate ? (float)(count & 1) : test_random();
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&src, g_lhs, count);
+  test_soa_set(&dst, g_rhs, count);
+  test_soa_set(&result, NULL, count);
+
+  kernels->lerp_v3f_soa(&src, &dst, factor, &result);
+  vector3f_soa_to_aos(&result, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = lerp_v3f(g_lhs[i], g_rhs[i], factor);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// a rotation, a translation and a non uniform scale, the identity for the
+// degenerate cases.
+static
+void
+test_set_m4f(matrix4f *dst, int32_t degenerate)
+{
+  quatf rotation;
+  matrix4f translation, scale;
+
+  if (degenerate) {
+    matrix4f_set_identity(dst);
+    return;
+  }
+
+  test_random_quatf(&rotation);
+  matrix4f_translation(
+    &translation, test_random(), test_random(), test_random());
+  matrix4f_scale(
+    &scale, test_random() + 0.5f, test_random() + 0.5f, test_random() + 0.5f);
+  *dst = quatf_to_matrix4f(rotation);
+  *dst = mult_m4f(&translation, dst);
+  *dst = mult_m4f(dst, &scale);
+}
+
+static
+void
+test_mult_m4f(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  for (uint32_t i = 0; i < count; ++i) {
+    matrix4f lhs, rhs, value, expected;
+    test_set_m4f(&lhs, 0);
+    test_set_m4f(&rhs, degenerate);
+    value = kernels->mult_m4f(&lhs, &rhs);
+    expected = mult_m4f(&lhs, &rhs);
+    test_check_floats(value.data, expected.data, 16, TEST_TOLERANCE, i);
+  }
+}
+
+// 'src' elements are 5 floats apart and 'dst' ones 4, the floats past the
+// first 3 must be left alone. The degenerate pass transforms in place.
+static
+void
+test_mult_m4f_strided(
+  void (*kernel)(
+    const matrix4f *, const float *, size_t, float *, size_t, uint32_t,
+    int32_t),
+  vector3f (*reference)(const matrix4f *, const vector3f *),
+  uint32_t count,
+  int32_t degenerate)
+{
+  static float src[TEST_MAX_COUNT * 5], dst[TEST_MAX_COUNT * 5];
+  static float before[TEST_MAX_COUNT * 5];
+  size_t src_stride = 5, dst_stride = degenerate ? 5 : 4;
+  float *target = degenerate ? src : dst;
+  matrix4f lhs;
+
+  test_set_m4f(&lhs, 0);
+  test_set_v3f_pair(count, degenerate);
+  for (uint32_t i = 0; i < count * 5; ++i) {
+    src[i] = test_random();
+    dst[i] = test_random();
+  }
+  for (uint32_t i = 0; i < count; ++i)
+    memcpy(src + i * src_stride, g_lhs[i].data, sizeof(vector3f));
+  memcpy(before, target, sizeof(float) * count * dst_stride);
+
+  kernel(
+    &lhs, src, src_stride * sizeof(float), target,
+    dst_stride * sizeof(float), count, (int32_t)(count & 1));
+  for (uint32_t i = 0; i < count; ++i) {
+    const float *value = target + i * dst_stride;
+    vector3f expected = reference(&lhs, g_lhs + i);
+    test_check_floats(value, expected.data, 3, TEST_TOLERANCE, i);
+    test_check_floats(
+      value + 3, before + i * dst_stride + 3, (uint32_t)dst_stride - 3, 0.f,
+      i);
+  }
+}
+
+static
+void
+test_mult_m4f_p3f_strided(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_mult_m4f_strided(
+    kernels->mult_m4f_p3f_strided, mult_m4f_p3f, count, degenerate);
+}
+
+static
+void
+test_mult_m4f_v3f_strided(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_mult_m4f_strided(
+    kernels->mult_m4f_v3f_strided, mult_m4f_v3f, count, degenerate);
+}
+
+static
+void
+test_mult_m4f_array(
+  void (*kernel)(const matrix4f *, const vector3f *, vector3f *, uint32_t),
+  vector3f (*reference)(const matrix4f *, const vector3f *),
+  uint32_t count,
+  int32_t degenerate)
+{
+  matrix4f lhs;
+  test_set_m4f(&lhs, 0);
+  test_set_v3f_pair(count, degenerate);
+
+  kernel(&lhs, g_lhs, g_out, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = reference(&lhs, g_lhs + i);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_mult_m4f_p3f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_mult_m4f_array(
+    kernels->mult_m4f_p3f_array, mult_m4f_p3f, count, degenerate);
+}
+
+static
+void
+test_mult_m4f_v3f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_mult_m4f_array(
+    kernels->mult_m4f_v3f_array, mult_m4f_v3f, count, degenerate);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// unit pairs and factors in [0, 1], the degenerate pairs are equal or opposite
+// and the factors at the ends.
+static
+void
+test_set_quatf_pairs(uint32_t count, int32_t degenerate)
+{
+  for (uint32_t i = 0; i < count; ++i) {
+    test_random_quatf(g_quats[0] + i);
+    test_random_quatf(g_quats[1] + i);
+    g_floats[i] = test_random();
+    if (!degenerate)
+      continue;
+
+    switch (i % 4) {
+      case 0:
+        g_quats[1][i] = g_quats[0][i];
+        break;
+      case 1:
+        g_quats[1][i] = g_quats[0][i];
+        mult_set_quatf_f(g_quats[1] + i, -1.f);
+        break;
+      case 2:
+        g_floats[i] = 0.f;
+        break;
+      default:
+        g_floats[i] = 1.f;
+        break;
+    }
+  }
+}
+
+static
+void
+test_slerp_quatf_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_quatf_pairs(count, degenerate);
+  kernels->slerp_quatf_array(
+    g_quats[0], g_quats[1], g_floats, g_quats_out, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    quatf expected = slerp_quatf_fast(g_quats[0][i], g_quats[1][i], g_floats[i]);
+    test_check_floats(
+      g_quats_out[i].data, expected.data, 4, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_nlerp_quatf_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_quatf_pairs(count, degenerate);
+  kernels->nlerp_quatf_array(
+    g_quats[0], g_quats[1], g_floats, g_quats_out, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    quatf expected = nlerp_quatf(g_quats[0][i], g_quats[1][i], g_floats[i]);
+    test_check_floats(
+      g_quats_out[i].data, expected.data, 4, TEST_TOLERANCE_MP, i);
+  }
+}
+
+static
+void
+test_mult_quatf_v3f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  quatf quat;
+  test_random_quatf(&quat);
+  if (degenerate)
+    mult_set_quatf_f(&quat, 2.5f);
+  test_set_v3f_pair(count, degenerate);
+
+  kernels->mult_quatf_v3f_array(&quat, g_lhs, g_out, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = mult_quatf_v3f(&quat, g_lhs + i);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_mult_quatf_v3f_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  vector3f_soa_t src, dst;
+  quatf quat;
+  test_random_quatf(&quat);
+  if (degenerate)
+    mult_set_quatf_f(&quat, 2.5f);
+  test_set_v3f_pair(count, degenerate);
+  test_soa_set(&src, g_lhs, count);
+  test_soa_set(&dst, NULL, count);
+
+  kernels->mult_quatf_v3f_soa(&quat, &src, &dst);
+  vector3f_soa_to_aos(&dst, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = mult_quatf_v3f(&quat, g_lhs + i);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+// the quaternions must be unit, the degenerate ones are the identity.
+static
+void
+test_mult_quatf_v3f_pairwise(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_quatf_pairs(count, 0);
+  test_set_v3f_pair(count, degenerate);
+  for (uint32_t i = 0; degenerate && i < count; i += 2)
+    quatf_set_identity(g_quats[0] + i);
+
+  kernels->mult_quatf_v3f_pairwise(g_quats[0], g_lhs, g_out, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected = mult_quatf_v3f_unit(g_quats[0] + i, g_lhs + i);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+// rotation matrices, the degenerate ones are the identity and half turns
+// which land on every branch of the conversion, including ties between the
+// diagonal terms.
+static
+void
+test_set_rotations(uint32_t count, int32_t degenerate)
+{
+  static const float half_turns[4][9] = {
+    { 1.f, 0.f, 0.f, 0.f, -1.f, 0.f, 0.f, 0.f, -1.f },
+    { -1.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, -1.f },
+    { -1.f, 0.f, 0.f, 0.f, -1.f, 0.f, 0.f, 0.f, 1.f },
+    { 0.f, 1.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, -1.f } };
+
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t index = i % 6;
+    test_random_quatf(g_quats[0] + i);
+    g_matrices[i] = quatf_to_matrix4f(g_quats[0][i]);
+    if (degenerate && index == 4)
+      matrix4f_set_identity(g_matrices + i);
+    else if (degenerate && index < 4)
+      for (uint32_t r = 0; r < 3; ++r)
+        for (uint32_t c = 0; c < 3; ++c)
+          g_matrices[i].data[r * 4 + c] = half_turns[index][r * 3 + c];
+
+    for (uint32_t r = 0; r < 3; ++r)
+      for (uint32_t c = 0; c < 3; ++c)
+        g_matrices3[i].data[r * 3 + c] = g_matrices[i].data[r * 4 + c];
+  }
+}
+
+static
+void
+test_quatf_set_from_rotation_matrix4f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_rotations(count, degenerate);
+  kernels->quatf_set_from_rotation_matrix4f_array(
+    g_quats_out, g_matrices, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    quatf expected;
+    quatf_set_from_rotation_matrix4f(&expected, g_matrices + i);
+    test_check_floats(
+      g_quats_out[i].data, expected.data, 4, EPSILON_FLOAT_MED_PRECISION, i);
+  }
+}
+
+static
+void
+test_quatf_set_from_rotation_matrix3f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_rotations(count, degenerate);
+  kernels->quatf_set_from_rotation_matrix3f_array(
+    g_quats_out, g_matrices3, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    quatf expected;
+    quatf_set_from_rotation_matrix3f(&expected, g_matrices3 + i);
+    test_check_floats(
+      g_quats_out[i].data, expected.data, 4, EPSILON_FLOAT_MED_PRECISION, i);
+  }
+}
+
+// any length, the degenerate ones are zero, tiny, or the identity.
+static
+void
+test_set_quats(uint32_t count, int32_t degenerate)
+{
+  for (uint32_t i = 0; i < count; ++i) {
+    test_random_quatf(g_quats[0] + i);
+    test_random_v3f(g_lhs + i, 4.f);
+    if (!degenerate) {
+      mult_set_quatf_f(g_quats[0] + i, test_random() * 1.5f + 0.5f);
+      continue;
+    }
+
+    switch (i % 4) {
+      case 0:
+        memset(g_quats[0] + i, 0, sizeof(quatf));
+        break;
+      case 1:
+        mult_set_quatf_f(g_quats[0] + i, 1e-3f);
+        break;
+      case 2:
+        quatf_set_identity(g_quats[0] + i);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+static
+void
+test_quatf_to_matrix4f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_quats(count, degenerate);
+  kernels->quatf_to_matrix4f_array(g_quats[0], g_matrices, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    matrix4f expected = quatf_to_matrix4f(g_quats[0][i]);
+    test_check_floats(
+      g_matrices[i].data, expected.data, 16, EPSILON_FLOAT_MED_PRECISION, i);
+  }
+}
+
+static
+void
+test_quatf_to_matrix3f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_quats(count, degenerate);
+  kernels->quatf_to_matrix3f_array(g_quats[0], g_matrices3, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    matrix4f expected = quatf_to_matrix4f(g_quats[0][i]);
+    for (uint32_t r = 0; r < 3; ++r)
+      test_check_floats(
+        g_matrices3[i].data + r * 3, expected.data + r * 4, 3,
+        EPSILON_FLOAT_MED_PRECISION, i);
+  }
+}
+
+// without translations for odd counts.
+static
+void
+test_quatf_to_matrix3x4f_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  const vector3f *translations = (count & 1) ? NULL : g_lhs;
+  test_set_quats(count, degenerate);
+  kernels->quatf_to_matrix3x4f_array(g_quats[0], translations, g_rigids, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    matrix4f expected = quatf_to_matrix4f(g_quats[0][i]);
+    for (uint32_t r = 0; r < 3; ++r) {
+      float translation = translations ? translations[i].data[r] : 0.f;
+      test_check_floats(
+        g_rigids[i].data + r * 4, expected.data + r * 4, 3,
+        EPSILON_FLOAT_MED_PRECISION, i);
+      test_check(g_rigids[i].data[r * 4 + 3], translation, 0.f, i);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the first influence has the largest weight. The degenerate vertices use a
+// single bone padded with 0 weights, the same bone three times, or a bone and
+// its opposite (the same transform).
+static
+void
+test_skin_dualquatf_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  static dualquatf bones[TEST_BONE_COUNT];
+  static uint32_t indices[TEST_MAX_COUNT * TEST_INFLUENCES];
+  static float weights[TEST_MAX_COUNT * TEST_INFLUENCES];
+  static vector3f normals[TEST_MAX_COUNT];
+  vector3f *dst_normals = (count & 1) ? NULL : normals;
+
+  for (uint32_t i = 0; i < TEST_BONE_COUNT; ++i) {
+    quatf rotation;
+    vector3f translation;
+    test_random_quatf(&rotation);
+    test_random_v3f(&translation, 4.f);
+    dualquatf_set_from_quatf_v3f(bones + i, &rotation, &translation);
+  }
+  bones[1] = bones[0];
+  mult_set_quatf_f(&bones[1].real, -1.f);
+  mult_set_quatf_f(&bones[1].dual, -1.f);
+
+  test_set_v3f_pair(count, 0);
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t *index = indices + i * TEST_INFLUENCES;
+    float *weight = weights + i * TEST_INFLUENCES;
+    for (uint32_t k = 0; k < TEST_INFLUENCES; ++k) {
+      index[k] = test_random_u32() % TEST_BONE_COUNT;
+      weight[k] = k ? test_random() * 0.25f : test_random() * 0.5f + 0.5f;
+    }
+    if (!degenerate)
+      continue;
+
+    switch (i % 3) {
+      case 0:
+        weight[1] = weight[2] = 0.f;
+        break;
+      case 1:
+        index[1] = index[2] = index[0];
+        break;
+      default:
+        index[0] = 0;
+        index[1] = 1;
+        break;
+    }
+  }
+
+  kernels->skin_dualquatf_array(
+    bones, indices, weights, TEST_INFLUENCES, g_lhs,
+    dst_normals ? g_rhs : NULL, g_out, dst_normals, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    dualquatf influences[TEST_INFLUENCES], blended;
+    vector3f expected;
+    for (uint32_t k = 0; k < TEST_INFLUENCES; ++k)
+      influences[k] = bones[indices[i * TEST_INFLUENCES + k]];
+    blended = blend_dualquatf(
+      influences, weights + i * TEST_INFLUENCES, TEST_INFLUENCES);
+
+    expected = mult_dualquatf_p3f(&blended, g_lhs + i);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+    if (dst_normals) {
+      expected = mult_dualquatf_v3f(&blended, g_rhs + i);
+      test_check_v3f(dst_normals + i, &expected, TEST_TOLERANCE, i);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the degenerate segment is collapsed, some points sit on its ends.
+static
+void
+test_set_segment_form(segment_form_t *dst, uint32_t count, int32_t degenerate)
+{
+  segment_t segment;
+  test_random_v3f(segment.points + 0, 3.f);
+  test_random_v3f(segment.points + 1, 3.f);
+  if (degenerate)
+    segment.points[1] = segment.points[0];
+  segment_form_set_from_segment(dst, &segment);
+
+  test_set_v3f_pair(count, 0);
+  for (uint32_t i = 0; degenerate && i < count; i += 3)
+    g_lhs[i] = segment.points[i & 1];
+}
+
+static
+void
+test_closest_point_on_segment_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  segment_form_t form;
+  vector3f_soa_t points, dst;
+  test_set_segment_form(&form, count, degenerate);
+  test_soa_set(&points, g_lhs, count);
+  test_soa_set(&dst, NULL, count);
+
+  kernels->closest_point_on_segment_soa(&form, &points, &dst);
+  vector3f_soa_to_aos(&dst, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    point3f expected = closest_point_on_segment_form(g_lhs + i, &form);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_get_point_distance_to_line_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  segment_form_t form;
+  vector3f_soa_t points;
+  test_set_segment_form(&form, count, degenerate);
+  test_soa_set(&points, g_lhs, count);
+
+  kernels->get_point_distance_to_line_soa(&form, &points, g_floats);
+  for (uint32_t i = 0; i < count; ++i)
+    test_check(
+      g_floats[i], get_point_distance_to_line_form(g_lhs + i, &form),
+      TEST_TOLERANCE, i);
+}
+
+static
+void
+test_closest_point_on_segment_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  segment_form_t form;
+  test_set_segment_form(&form, count, degenerate);
+
+  kernels->closest_point_on_segment_array(&form, g_lhs, g_out, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    point3f expected = closest_point_on_segment_form(g_lhs + i, &form);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE, i);
+  }
+}
+
+// the degenerate pairs are parallel, collapsed, equal or crossing. The closest
+// points are only compared for the random pairs, the others can have several.
+// 'on_lhs' and 'on_rhs' are left out for odd counts.
+static
+void
+test_closest_points_on_segments_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  segment_soa_t lhs, rhs;
+  vector3f_soa_t on_lhs, on_rhs;
+  int32_t points = !(count & 1);
+
+  for (uint32_t i = 0; i < count; ++i) {
+    segment_t *l = g_segments[0] + i, *r = g_segments[1] + i;
+    vector3f offset;
+    for (uint32_t k = 0; k < 2; ++k) {
+      test_random_v3f(l->points + k, 3.f);
+      test_random_v3f(r->points + k, 3.f);
+    }
+    if (!degenerate)
+      continue;
+
+    test_random_v3f(&offset, 1.f);
+    switch (i % 5) {
+      case 0:
+        r->points[0] = add_v3f(l->points + 0, &offset);
+        r->points[1] = add_v3f(l->points + 1, &offset);
+        break;
+      case 1:
+        l->points[1] = l->points[0];
+        break;
+      case 2:
+        l->points[1] = l->points[0];
+        r->points[1] = r->points[0];
+        break;
+      case 3:
+        *r = *l;
+        break;
+      default:
+        r->points[0] = lerp_v3f(l->points[0], l->points[1], 0.5f);
+        r->points[1] = add_v3f(r->points + 0, &offset);
+        r->points[0] = diff_v3f(&offset, r->points + 0);
+        break;
+    }
+  }
+  test_segment_soa_set(&lhs, g_segments[0], count);
+  test_segment_soa_set(&rhs, g_segments[1], count);
+  test_soa_set(&on_lhs, NULL, count);
+  test_soa_set(&on_rhs, NULL, count);
+
+  kernels->closest_points_on_segments_soa(
+    &lhs, &rhs, g_floats, points ? &on_lhs : NULL, points ? &on_rhs : NULL);
+  vector3f_soa_to_aos(&on_lhs, g_out);
+  vector3f_soa_to_aos(&on_rhs, g_rhs);
+  for (uint32_t i = 0; i < count; ++i) {
+    point3f c1, c2;
+    float expected = closest_points_on_segments(
+      g_segments[0] + i, g_segments[1] + i, &c1, &c2);
+    test_check(g_floats[i], expected, TEST_TOLERANCE, i);
+    if (points && !degenerate) {
+      test_check_v3f(g_out + i, &c1, TEST_TOLERANCE, i);
+      test_check_v3f(g_rhs + i, &c2, TEST_TOLERANCE, i);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the degenerate faces are collapsed or have exactly collinear points.
+static
+void
+test_set_faces(uint32_t count, int32_t degenerate)
+{
+  for (uint32_t i = 0; i < count; ++i) {
+    for (uint32_t k = 0; k < 3; ++k)
+      test_random_v3f(g_faces[i].points + k, 2.f);
+    if (!degenerate || i % 3 == 2)
+      continue;
+
+    if (i % 3 == 0) {
+      g_faces[i].points[1] = g_faces[i].points[2] = g_faces[i].points[0];
+    } else {
+      vector3f_set_3f(g_faces[i].points + 0, 0.f, 0.f, 0.f);
+      vector3f_set_3f(g_faces[i].points + 1, 1.f, 2.f, 3.f);
+      vector3f_set_3f(g_faces[i].points + 2, 2.f, 4.f, 6.f);
+    }
+  }
+}
+
+static
+void
+test_get_faces_normals_fast(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_faces(count, degenerate);
+  kernels->get_faces_normals_fast(g_faces, count, g_out);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected;
+    get_face_normal_safe(g_faces + i, &expected);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE_MP, i);
+  }
+}
+
+// the slices of 1 to 4 partitions must cover the range, the normals start as
+// NaNs which no face gives.
+static
+void
+test_get_faces_normals_partition(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  uint32_t partition_count = 1 + count % 4;
+  test_set_faces(count, degenerate);
+  for (uint32_t i = 0; i < count; ++i)
+    vector3f_set_1f(g_out + i, NAN);
+
+  for (uint32_t i = 0; i < partition_count; ++i)
+    kernels->get_faces_normals_partition(
+      g_faces, count, g_out, i, partition_count);
+  for (uint32_t i = 0; i < count; ++i) {
+    vector3f expected;
+    get_face_normal_safe(g_faces + i, &expected);
+    test_check_v3f(g_out + i, &expected, TEST_TOLERANCE_MP, i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the classification masks of 'distances', the distances within TEST_MARGIN of
+// the thresholds are marked as ignored. The word past the last one is a guard.
+#define TEST_CLASSIFY_EPSILON 0.25f
+
+static
+void
+test_classify(
+  const float *distances,
+  uint32_t count,
+  uint32_t *front,
+  uint32_t *back,
+  uint32_t *ignored)
+{
+  memset(front, 0, sizeof(uint32_t) * (count + 31) / 32);
+  memset(back, 0, sizeof(uint32_t) * (count + 31) / 32);
+  memset(ignored, 0, sizeof(uint32_t) * (count + 31) / 32);
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t bit = 1u << (i % 32);
+    if (fabsf(fabsf(distances[i]) - TEST_CLASSIFY_EPSILON) < TEST_MARGIN)
+      ignored[i / 32] |= bit;
+    if (distances[i] > TEST_CLASSIFY_EPSILON)
+      front[i / 32] |= bit;
+    if (distances[i] < -TEST_CLASSIFY_EPSILON)
+      back[i / 32] |= bit;
+  }
+}
+
+static
+void
+test_check_classify(
+  const uint32_t *front,
+  const uint32_t *back,
+  const float *distances,
+  uint32_t count)
+{
+  uint32_t expected_front[TEST_MAX_COUNT / 32 + 1];
+  uint32_t expected_back[TEST_MAX_COUNT / 32 + 1];
+  uint32_t ignored[TEST_MAX_COUNT / 32 + 1];
+  uint32_t words = (count + 31) / 32;
+
+  test_classify(distances, count, expected_front, expected_back, ignored);
+  for (uint32_t i = 0; i < words; ++i) {
+    test_check_bits(front[i], expected_front[i], ignored[i], i);
+    test_check_bits(back[i], expected_back[i], ignored[i], i);
+  }
+  test_check_bits(front[words], 0xdeadbeef, 0, words);
+  test_check_bits(back[words], 0xdeadbeef, 0, words);
+}
+
+// points around a random plane, the degenerate ones are on it.
+static
+void
+test_set_plane_points(plane_t *plane, uint32_t count, int32_t degenerate)
+{
+  face_t face;
+  for (uint32_t k = 0; k < 3; ++k)
+    test_random_v3f(face.points + k, 2.f);
+  plane_set_from_face(plane, &face);
+
+  test_set_v3f_pair(count, 0);
+  for (uint32_t i = 0; degenerate && i < count; i += 2)
+    g_lhs[i] = lerp_v3f(face.points[0], face.points[1], test_random());
+}
+
+static
+void
+test_get_plane_distance_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  plane_t plane;
+  vector3f_soa_t points;
+  test_set_plane_points(&plane, count, degenerate);
+  test_soa_set(&points, g_lhs, count);
+
+  kernels->get_plane_distance_soa(&plane, &points, g_floats);
+  for (uint32_t i = 0; i < count; ++i)
+    test_check(
+      g_floats[i], get_plane_distance(&plane, g_lhs + i), TEST_TOLERANCE, i);
+}
+
+static
+void
+test_classify_plane_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  uint32_t front[TEST_MAX_COUNT / 32 + 2], back[TEST_MAX_COUNT / 32 + 2];
+  uint32_t words = (count + 31) / 32;
+  plane_t plane;
+  vector3f_soa_t points;
+  test_set_plane_points(&plane, count, degenerate);
+  test_soa_set(&points, g_lhs, count);
+  front[words] = back[words] = 0xdeadbeef;
+
+  kernels->classify_plane_soa(
+    &plane, &points, TEST_CLASSIFY_EPSILON, front, back);
+  for (uint32_t i = 0; i < count; ++i)
+    g_floats[i] = get_plane_distance(&plane, g_lhs + i);
+  test_check_classify(front, back, g_floats, count);
+}
+
+// 'point' is on the first face for the degenerate cases.
+static
+void
+test_set_face_cache(
+  face_cache_t *cache,
+  point3f *point,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_set_faces(count, 0);
+  face_cache_set_buffer(
+    cache, test_alloc(get_face_cache_buffer_size(count)), count);
+  face_cache_set_from_faces(cache, g_faces);
+
+  test_random_v3f(point, 2.f);
+  if (degenerate)
+    *point = g_faces[0].points[1];
+  for (uint32_t i = 0; i < count; ++i) {
+    plane_t plane;
+    plane_set_from_face(&plane, g_faces + i);
+    g_floats[i] = get_plane_distance(&plane, point);
+  }
+}
+
+static
+void
+test_get_face_cache_distance(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  static float distances[TEST_MAX_COUNT];
+  face_cache_t cache;
+  point3f point;
+  test_set_face_cache(&cache, &point, count, degenerate);
+
+  kernels->get_face_cache_distance(&cache, &point, distances);
+  test_check_floats(distances, g_floats, count, TEST_TOLERANCE, 0);
+}
+
+static
+void
+test_classify_face_cache(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  uint32_t front[TEST_MAX_COUNT / 32 + 2], back[TEST_MAX_COUNT / 32 + 2];
+  uint32_t words = (count + 31) / 32;
+  face_cache_t cache;
+  point3f point;
+  test_set_face_cache(&cache, &point, count, degenerate);
+  front[words] = back[words] = 0xdeadbeef;
+
+  kernels->classify_face_cache(
+    &cache, &point, TEST_CLASSIFY_EPSILON, front, back);
+  test_check_classify(front, back, g_floats, count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the frustum of a rotated, translated and scaled box. The bodies within
+// TEST_MARGIN of a plane are not compared. Each cull runs twice, the second
+// time with the hints of the first. The degenerate bodies have a zero radius
+// and height.
+static
+void
+test_cull_frustum(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate,
+  int32_t capsules)
+{
+  static sphere_t spheres[TEST_MAX_COUNT];
+  static capsule_t bodies[TEST_MAX_COUNT];
+  uint32_t visible[TEST_MAX_COUNT / 32 + 2];
+  uint32_t expected[TEST_MAX_COUNT / 32 + 1], ignored[TEST_MAX_COUNT / 32 + 1];
+  uint8_t hints[TEST_MAX_COUNT / 32 + 1];
+  uint32_t words = (count + 31) / 32;
+  frustum_t frustum;
+  matrix4f view;
+
+  test_set_m4f(&view, 0);
+  frustum_set_from_matrix4f(
+    &frustum, &view,
+    (count & 1) ?
+      FRUSTUM_DEPTH_NEGATIVE_ONE_TO_ONE : FRUSTUM_DEPTH_ZERO_TO_ONE);
+
+  memset(expected, 0, sizeof(expected));
+  memset(ignored, 0, sizeof(ignored));
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t bit = 1u << (i % 32), inside[2];
+    test_random_v3f(&bodies[i].center, 3.f);
+    bodies[i].radius = degenerate ? 0.f : test_random() + 0.05f;
+    bodies[i].half_height = degenerate ? 0.f : test_random();
+    spheres[i].center = bodies[i].center;
+    spheres[i].radius = bodies[i].radius;
+
+    for (uint32_t k = 0; k < 2; ++k) {
+      capsule_t body = bodies[i];
+      body.radius += k ? TEST_MARGIN : -TEST_MARGIN;
+      if (capsules)
+        inside[k] = is_capsule_in_frustum(&frustum, &body) != 0;
+      else {
+        sphere_t sphere = { body.center, body.radius };
+        inside[k] = is_sphere_in_frustum(&frustum, &sphere) != 0;
+      }
+    }
+
+    if (inside[0] != inside[1])
+      ignored[i / 32] |= bit;
+    else if (inside[0])
+      expected[i / 32] |= bit;
+  }
+
+  memset(hints, 0, sizeof(hints));
+  for (uint32_t pass = 0; pass < 2; ++pass) {
+    visible[words] = 0xdeadbeef;
+    if (capsules)
+      kernels->cull_capsules_frustum(&frustum, bodies, count, visible, hints);
+    else
+      kernels->cull_spheres_frustum(&frustum, spheres, count, visible, hints);
+    for (uint32_t i = 0; i < words; ++i)
+      test_check_bits(visible[i], expected[i], ignored[i], i);
+    test_check_bits(visible[words], 0xdeadbeef, 0, words);
+  }
+}
+
+static
+void
+test_cull_spheres_frustum(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_cull_frustum(kernels, count, degenerate, 0);
+}
+
+static
+void
+test_cull_capsules_frustum(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  test_cull_frustum(kernels, count, degenerate, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// copies of the triangle (0, 0), (4, 0), (0, 4) at z = 'depth', optionally
+// moved out of the way or collapsed. Every ray is parallel to z and starts at
+// z = 0 well inside or well outside the triangle, so no hit is decided by the
+// rounding.
+static
+void
+test_set_ray_face(face_t *dst, float depth, int32_t away, int32_t collapsed)
+{
+  float x = away ? 100.f : 0.f;
+  vector3f_set_3f(dst->points + 0, x, 0.f, depth);
+  vector3f_set_3f(dst->points + 1, x + 4.f, 0.f, depth);
+  vector3f_set_3f(dst->points + 2, x, 4.f, depth);
+  if (test_random() < 0.5f) {
+    point3f swap = dst->points[1];
+    dst->points[1] = dst->points[2];
+    dst->points[2] = swap;
+  }
+  if (collapsed)
+    dst->points[1] = dst->points[2] = dst->points[0];
+}
+
+// 'parallel' rays go along x and miss every face.
+static
+void
+test_set_ray(ray_t *dst, int32_t outside, int32_t parallel)
+{
+  float u = test_random() * 0.3f + (outside ? 0.6f : 0.1f);
+  float v = test_random() * 0.3f + (outside ? 0.6f : 0.1f);
+  float length = test_random() * 1.5f + 0.5f;
+  vector3f_set_3f(&dst->origin, u * 4.f, v * 4.f, 0.f);
+  vector3f_set_3f(&dst->direction, 0.f, 0.f, length);
+  if (parallel)
+    vector3f_set_3f(&dst->direction, length, 0.f, 0.f);
+  else if (test_random() < 0.2f)
+    dst->direction.data[2] = -length;
+}
+
+static
+void
+test_raycast_faces_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  face_soa_t faces;
+  ray_t ray;
+  ray_hit_t hit, expected;
+  int32_t found, expected_found;
+
+  for (uint32_t i = 0; i < count; ++i)
+    test_set_ray_face(
+      g_faces + i, test_random() * 8.f + 1.f, test_random() < 0.5f,
+      degenerate && (i % 3 == 0));
+  face_soa_set_buffer(
+    &faces, test_alloc(get_face_soa_buffer_size(count)), count);
+  face_soa_set_from_faces(&faces, g_faces);
+  test_set_ray(&ray, 0, degenerate && (count & 1));
+
+  memset(&hit, 0, sizeof(hit));
+  hit.distance = FLT_MAX;
+  expected = hit;
+  found = kernels->raycast_faces_soa(&ray, &faces, &hit);
+  expected_found = raycast_faces(&ray, g_faces, count, &expected);
+  test_check((float)found, (float)expected_found, 0.f, 0);
+  test_check((float)hit.face, (float)expected.face, 0.f, 0);
+  test_check(hit.distance, expected.distance, TEST_TOLERANCE, 0);
+  test_check(hit.u, expected.u, TEST_TOLERANCE, 0);
+  test_check(hit.v, expected.v, TEST_TOLERANCE, 0);
+}
+
+// the faces are visited out of depth order, some rays start with a closer
+// hit. The degenerate set adds a collapsed face and parallel rays.
+static
+void
+test_raycast_face_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  static const float depths[TEST_RAY_FACES] = { 3.f, 1.f, 4.f, 2.f, 5.f };
+  static ray_hit_t expected[TEST_MAX_COUNT];
+  static ray_t rays[TEST_MAX_COUNT];
+  face_t faces[TEST_RAY_FACES];
+  ray_soa_t soa;
+  ray_hit_soa_t hits;
+
+  for (uint32_t i = 0; i < TEST_RAY_FACES; ++i)
+    test_set_ray_face(
+      faces + i, depths[i], i == 4 && !degenerate, i == 4 && degenerate);
+  test_soa_set(&soa.origins, NULL, count);
+  test_soa_set(&soa.directions, NULL, count);
+  hits.distances = (float *)test_alloc(sizeof(float) * count);
+  hits.u = (float *)test_alloc(sizeof(float) * count);
+  hits.v = (float *)test_alloc(sizeof(float) * count);
+  hits.faces = (uint32_t *)test_alloc(sizeof(uint32_t) * count);
+
+  for (uint32_t i = 0; i < count; ++i) {
+    test_set_ray(rays + i, i % 3 == 0, degenerate && (i & 1));
+    g_lhs[i] = rays[i].origin;
+    g_rhs[i] = rays[i].direction;
+    expected[i].distance = (i % 7 == 0) ? 2.5f : FLT_MAX;
+    expected[i].u = expected[i].v = 0.f;
+    expected[i].face = ~0u;
+    hits.distances[i] = expected[i].distance;
+    hits.u[i] = hits.v[i] = 0.f;
+    hits.faces[i] = ~0u;
+  }
+  vector3f_soa_set_from_aos(&soa.origins, g_lhs, count);
+  vector3f_soa_set_from_aos(&soa.directions, g_rhs, count);
+
+  for (uint32_t k = 0; k < TEST_RAY_FACES; ++k) {
+    kernels->raycast_face_soa(&soa, faces + k, k, &hits);
+    for (uint32_t i = 0; i < count; ++i)
+      raycast_face(rays + i, faces + k, k, expected + i);
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    test_check((float)hits.faces[i], (float)expected[i].face, 0.f, i);
+    test_check(hits.distances[i], expected[i].distance, TEST_TOLERANCE, i);
+    test_check(hits.u[i], expected[i].u, TEST_TOLERANCE, i);
+    test_check(hits.v[i], expected[i].v, TEST_TOLERANCE, i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// the degenerate capsules have no height, no radius or no rotation.
+static
+void
+test_set_oriented_capsules(
+  oriented_capsule_t *capsules,
+  uint32_t count,
+  int32_t degenerate)
+{
+  for (uint32_t i = 0; i < count; ++i) {
+    oriented_capsule_t *capsule = capsules + i;
+    test_random_v3f(&capsule->center, 4.f);
+    test_random_quatf(&capsule->orientation);
+    capsule->half_height = test_random();
+    capsule->radius = test_random() + 0.1f;
+    if (!degenerate)
+      continue;
+
+    switch (i % 3) {
+      case 0:
+        capsule->half_height = 0.f;
+        break;
+      case 1:
+        capsule->radius = 0.f;
+        break;
+      default:
+        quatf_set_identity(&capsule->orientation);
+        break;
+    }
+  }
+}
+
+static
+void
+test_get_oriented_capsule_segment_soa(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  static oriented_capsule_t capsules[TEST_MAX_COUNT];
+  segment_soa_t segments;
+  test_set_oriented_capsules(capsules, count, degenerate);
+  test_soa_set(segments.points + 0, NULL, count);
+  test_soa_set(segments.points + 1, NULL, count);
+
+  kernels->get_oriented_capsule_segment_soa(capsules, &segments);
+  vector3f_soa_to_aos(segments.points + 0, g_lhs);
+  vector3f_soa_to_aos(segments.points + 1, g_rhs);
+  for (uint32_t i = 0; i < count; ++i) {
+    segment_t expected;
+    get_oriented_capsule_segment(capsules + i, &expected);
+    test_check_v3f(g_lhs + i, expected.points + 0, TEST_TOLERANCE, i);
+    test_check_v3f(g_rhs + i, expected.points + 1, TEST_TOLERANCE, i);
+  }
+}
+
+static
+void
+test_get_oriented_capsule_aabb_array(
+  const math_kernels_t *kernels,
+  uint32_t count,
+  int32_t degenerate)
+{
+  static oriented_capsule_t capsules[TEST_MAX_COUNT];
+  static aabb_t bounds[TEST_MAX_COUNT];
+  test_set_oriented_capsules(capsules, count, degenerate);
+
+  kernels->get_oriented_capsule_aabb_array(capsules, bounds, count);
+  for (uint32_t i = 0; i < count; ++i) {
+    aabb_t expected;
+    get_oriented_capsule_aabb(capsules + i, &expected);
+    test_check_v3f(bounds[i].points + 0, expected.points + 0, TEST_TOLERANCE, i);
+    test_check_v3f(bounds[i].points + 1, expected.points + 1, TEST_TOLERANCE, i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// in the order of math_kernels_t, one per entry.
+#define TEST_ENTRY(NAME) { #NAME, test_##NAME }
+
+static const test_t g_tests[] = {
+  TEST_ENTRY(length_v3f_soa),
+  TEST_ENTRY(length_squared_v3f_soa),
+  TEST_ENTRY(dot_product_v3f_soa),
+  TEST_ENTRY(cross_product_v3f_soa),
+  TEST_ENTRY(normalize_v3f_soa),
+  TEST_ENTRY(normalize_v3f_soa_mp),
+  TEST_ENTRY(normalize_v3f_soa_np),
+  TEST_ENTRY(negate_v3f_soa),
+  TEST_ENTRY(diff_v3f_soa),
+  TEST_ENTRY(add_v3f_soa),
+  TEST_ENTRY(mult_v3f_soa),
+  TEST_ENTRY(lerp_v3f_soa),
+  TEST_ENTRY(mult_m4f),
+  TEST_ENTRY(mult_m4f_p3f_strided),
+  TEST_ENTRY(mult_m4f_v3f_strided),
+  TEST_ENTRY(mult_m4f_p3f_array),
+  TEST_ENTRY(mult_m4f_v3f_array),
+  TEST_ENTRY(slerp_quatf_array),
+  TEST_ENTRY(nlerp_quatf_array),
+  TEST_ENTRY(mult_quatf_v3f_array),
+  TEST_ENTRY(mult_quatf_v3f_soa),
+  TEST_ENTRY(mult_quatf_v3f_pairwise),
+  TEST_ENTRY(quatf_set_from_rotation_matrix4f_array),
+  TEST_ENTRY(quatf_set_from_rotation_matrix3f_array),
+  TEST_ENTRY(quatf_to_matrix4f_array),
+  TEST_ENTRY(quatf_to_matrix3f_array),
+  TEST_ENTRY(quatf_to_matrix3x4f_array),
+  TEST_ENTRY(skin_dualquatf_array),
+  TEST_ENTRY(closest_point_on_segment_soa),
+  TEST_ENTRY(get_point_distance_to_line_soa),
+  TEST_ENTRY(closest_point_on_segment_array),
+  TEST_ENTRY(closest_points_on_segments_soa),
+  TEST_ENTRY(get_faces_normals_fast),
+  TEST_ENTRY(get_faces_normals_partition),
+  TEST_ENTRY(get_plane_distance_soa),
+  TEST_ENTRY(classify_plane_soa),
+  TEST_ENTRY(get_face_cache_distance),
+  TEST_ENTRY(classify_face_cache),
+  TEST_ENTRY(cull_spheres_frustum),
+  TEST_ENTRY(cull_capsules_frustum),
+  TEST_ENTRY(raycast_faces_soa),
+  TEST_ENTRY(raycast_face_soa),
+  TEST_ENTRY(get_oriented_capsule_segment_soa),
+  TEST_ENTRY(get_oriented_capsule_aabb_array)
+};
+
+// a new entry in math_kernels_t needs its test.
+static_assert(
+  sizeof(g_tests) / sizeof(g_tests[0]) ==
+  (sizeof(math_kernels_t) - offsetof(math_kernels_t, length_v3f_soa)) /
+  sizeof(void (*)(void)),
+  "every entry of math_kernels_t must have a test!");
+
+static const uint32_t g_counts[] = { 1, 3, 7, 8, 9, 15, 16, 17, 33, 64 };
+
+////////////////////////////////////////////////////////////////////////////////
+int
+main(void)
+{
+  const uint32_t test_count = sizeof(g_tests) / sizeof(g_tests[0]);
+  const uint32_t count_count = sizeof(g_counts) / sizeof(g_counts[0]);
+
+  for (uint32_t isa = 0; isa < MATH_KERNELS_COUNT; ++isa) {
+    const math_kernels_t *kernels =
+      get_math_kernels_isa((MATH_KERNELS_ISA)isa);
+    uint32_t checks = g_checks, failures = g_failures;
+    if (!kernels)
+      continue;
+
+    g_table = kernels->name;
+    for (uint32_t i = 0; i < test_count; ++i) {
+      g_kernel = g_tests[i].name;
+      for (uint32_t c = 0; c < count_count; ++c) {
+        for (int32_t degenerate = 0; degenerate < 2; ++degenerate) {
+          g_count = g_counts[c];
+          g_degenerate = degenerate;
+          g_arena_used = 0;
+          g_tests[i].function(kernels, g_count, degenerate);
+        }
+      }
+    }
+
+    printf(
+      "%-8s %u kernels, %u checks, %u failures\n",
+      g_table, test_count, g_checks - checks, g_failures - failures);
+  }
+
+  return g_failures ? 1 : 0;
+}